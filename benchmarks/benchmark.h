@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef GSL_BENCHMARK_H
+#define GSL_BENCHMARK_H
+
+#include <gsl/gsl_assert>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+//
+// Minimal benchmark harness for the GSL micro-benchmarks.
+//
+// Every benchmark is run a fixed number of times and the fastest run is kept, which
+// gives reproducible numbers on an otherwise idle machine. A suite writes its
+// results, together with the build configuration, as JSON on stdout.
+//
+namespace benchmark
+{
+
+// keeps the compiler from discarding a computed value
+template <class T>
+inline void do_not_optimize(const T& value)
+{
+#if defined(__clang__) || defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// runs f() `repetitions` times and returns the fastest run in nanoseconds
+template <class F>
+double measure(F f, int repetitions = 15)
+{
+    using clock = std::chrono::steady_clock;
+
+    double best = 0.0;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = clock::now();
+        f();
+        const auto stop = clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        best = (i == 0) ? ns : std::min(best, ns);
+    }
+    return best;
+}
+
+inline const char* contract_mode()
+{
+#if defined(GSL_THROW_ON_CONTRACT_VIOLATION)
+    return "throw";
+#elif defined(GSL_TERMINATE_ON_CONTRACT_VIOLATION)
+    return "terminate";
+#elif defined(GSL_UNENFORCED_ON_CONTRACT_VIOLATION)
+    return "unenforced";
+#elif defined(GSL_SAMPLED_ON_CONTRACT_VIOLATION)
+    return "sampled";
+#else
+    return "unknown";
+#endif
+}
+
+inline const char* compiler()
+{
+#if defined(__clang__)
+    return "clang " __clang_version__;
+#elif defined(__GNUC__)
+    return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " GSL_STRINGIFY(_MSC_FULL_VER);
+#else
+    return "unknown";
+#endif
+}
+
+class suite
+{
+public:
+    explicit suite(const char* name) : name_(name) {}
+
+    // times f(); items is the number of elements (or bytes) one call of f() processes
+    template <class F>
+    void run(const std::string& name, std::size_t items, F f, int repetitions = 15)
+    {
+        results_.push_back({name, measure(f, repetitions), items});
+    }
+
+    // adds a key/value pair to the configuration written with the results
+    void set(const std::string& key, const std::string& value) { config_.push_back({key, value}); }
+
+    void write_json(std::FILE* out = stdout) const
+    {
+        std::fprintf(out, "{\n  \"suite\": \"%s\",\n", name_.c_str());
+        std::fprintf(out, "  \"contract_mode\": \"%s\",\n", contract_mode());
+#if defined(GSL_NO_AUDIT_CONTRACTS)
+        std::fprintf(out, "  \"audit_contracts\": \"off\",\n");
+#else
+        std::fprintf(out, "  \"audit_contracts\": \"on\",\n");
+#endif
+        std::fprintf(out, "  \"compiler\": \"%s\",\n", compiler());
+        for (const auto& c : config_)
+            std::fprintf(out, "  \"%s\": \"%s\",\n", c.first.c_str(), c.second.c_str());
+        std::fprintf(out, "  \"results\": [\n");
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const auto& r = results_[i];
+            std::fprintf(out,
+                         "    {\"name\": \"%s\", \"ns\": %.1f, \"items\": %zu, \"ns_per_item\": %.4f}%s\n",
+                         r.name.c_str(), r.ns, r.items,
+                         r.items ? r.ns / static_cast<double>(r.items) : 0.0,
+                         i + 1 < results_.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+    }
+
+private:
+    struct result
+    {
+        std::string name;
+        double ns;
+        std::size_t items;
+    };
+
+    std::string name_;
+    std::vector<std::pair<std::string, std::string>> config_;
+    std::vector<result> results_;
+};
+
+} // namespace benchmark
+
+#endif // GSL_BENCHMARK_H
@@ -0,0 +1,76 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/bit_span>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace gsl;
+
+int main()
+{
+    benchmark::suite suite("bit_span");
+
+    // a presence bitmap with about one bit in 64 set
+    const std::size_t bits = std::size_t(1) << 26;
+    std::mt19937_64 rng(42);
+    std::vector<std::uint64_t> words(bits / 64);
+    std::vector<bool> packed(bits);
+    std::unique_ptr<bool[]> unpacked(new bool[bits]());
+    for (std::size_t i = 0; i < bits / 64; ++i) {
+        const std::size_t bit = i * 64 + rng() % 64;
+        words[i] |= std::uint64_t{1} << (bit % 64);
+        packed[bit] = true;
+        unpacked[bit] = true;
+    }
+    const bit_span<const std::uint64_t> view(words);
+    const span<const bool> bools(unpacked.get(), static_cast<std::ptrdiff_t>(bits));
+
+    suite.run("count, vector<bool>", bits, [&] {
+        benchmark::do_not_optimize(std::count(packed.begin(), packed.end(), true));
+    });
+    suite.run("count, span<bool>", bits, [&] {
+        benchmark::do_not_optimize(std::count(bools.data(), bools.data() + bools.size(), true));
+    });
+    suite.run("count, bit_span", bits, [&] { benchmark::do_not_optimize(view.count()); });
+    suite.run("count, bit_span iterators", bits, [&] {
+        benchmark::do_not_optimize(std::count(view.begin(), view.end(), true));
+    });
+
+    suite.run("visit set bits, vector<bool>", bits, [&] {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < bits; ++i)
+            if (packed[i]) sum += i;
+        benchmark::do_not_optimize(sum);
+    });
+    suite.run("visit set bits, bit_span find_next_set", bits, [&] {
+        std::ptrdiff_t sum = 0;
+        const auto last = view.size() - 1;
+        for (auto i = view.find_first_set(); i != view.size(); i = i == last ? view.size() : view.find_next_set(i))
+            sum += i;
+        benchmark::do_not_optimize(sum);
+    });
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,71 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/gsl_algorithm>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+int main()
+{
+    benchmark::suite suite("bitwise");
+
+    const char* const level_names[] = {"scalar", "sse2", "sse42", "avx2", "avx512"};
+
+    // one buffer that stays in L1 and one that streams from memory
+    for (std::size_t size : {std::size_t(4) << 10, std::size_t(64) << 20}) {
+        const std::string bytes = std::to_string(size >> 10) + " KiB";
+        std::vector<byte> a(size, to_byte<0x5a>());
+        std::vector<byte> b(size, to_byte<0x3c>());
+        std::vector<byte> dest(size);
+
+        suite.run("and, span element loop, " + bytes, size, [&] {
+            span<const byte> x = a;
+            span<const byte> y = b;
+            span<byte> d = dest;
+            for (std::ptrdiff_t i = 0; i < x.size(); ++i) d[i] = x[i] & y[i];
+            benchmark::do_not_optimize(dest[size - 1]);
+        });
+        suite.run("and, pointer loop, " + bytes, size, [&] {
+            const byte* x = a.data();
+            const byte* y = b.data();
+            byte* d = dest.data();
+            for (std::size_t i = 0; i < size; ++i) d[i] = x[i] & y[i];
+            benchmark::do_not_optimize(dest[size - 1]);
+        });
+        for (int level = 0; level <= static_cast<int>(details::cpu_simd_level()); ++level) {
+            suite.run(std::string("and, ") + level_names[level] + " kernel, " + bytes, size, [&] {
+                details::bitwise_transform<details::bit_and_op>(static_cast<details::simd_level>(level),
+                                                                a.data(), b.data(), dest.data(),
+                                                                static_cast<std::ptrdiff_t>(size));
+                benchmark::do_not_optimize(dest[size - 1]);
+            });
+        }
+        suite.run("xor in place, bitwise_xor, " + bytes, size, [&] {
+            bitwise_xor(dest, a);
+            benchmark::do_not_optimize(dest[size - 1]);
+        });
+    }
+
+    suite.write_json();
+    return 0;
+}
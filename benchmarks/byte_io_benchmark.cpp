@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "benchmark.h"
+
+#include <gsl/byte_io>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+
+struct record
+{
+    std::uint16_t type;
+    std::uint16_t flags;
+    std::uint32_t length;
+    std::uint64_t id;
+    double value;
+};
+
+const std::ptrdiff_t record_size = 2 + 2 + 4 + 8 + 8;
+
+// the code a protocol handler writes by hand: memcpy, a byte swap and one length check
+// per record
+template <class T>
+T load_big(const byte* p)
+{
+    using bits_type = typename details::uint_of_size<sizeof(T)>::type;
+    bits_type bits;
+    std::memcpy(&bits, p, sizeof(T));
+    bits = details::byteswap(bits);
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+template <class T>
+void store_big(byte* p, T value)
+{
+    using bits_type = typename details::uint_of_size<sizeof(T)>::type;
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    bits = details::byteswap(bits);
+    std::memcpy(p, &bits, sizeof(T));
+}
+
+bool decode_by_hand(const std::vector<byte>& in, std::vector<record>& out)
+{
+    const byte* p = in.data();
+    std::size_t left = in.size();
+    for (auto& r : out) {
+        if (left < static_cast<std::size_t>(record_size)) return false;
+        r.type = load_big<std::uint16_t>(p);
+        r.flags = load_big<std::uint16_t>(p + 2);
+        r.length = load_big<std::uint32_t>(p + 4);
+        r.id = load_big<std::uint64_t>(p + 8);
+        r.value = load_big<double>(p + 16);
+        p += record_size;
+        left -= static_cast<std::size_t>(record_size);
+    }
+    return true;
+}
+
+void encode_by_hand(const std::vector<record>& in, std::vector<byte>& out)
+{
+    byte* p = out.data();
+    std::size_t left = out.size();
+    for (const auto& r : in) {
+        if (left < static_cast<std::size_t>(record_size)) return;
+        store_big(p, r.type);
+        store_big(p + 2, r.flags);
+        store_big(p + 4, r.length);
+        store_big(p + 8, r.id);
+        store_big(p + 16, r.value);
+        p += record_size;
+        left -= static_cast<std::size_t>(record_size);
+    }
+}
+
+template <class Reader>
+void read_record(Reader& reader, record& r)
+{
+    r.type = reader.template read<std::uint16_t>();
+    r.flags = reader.template read<std::uint16_t>();
+    r.length = reader.template read<std::uint32_t>();
+    r.id = reader.template read<std::uint64_t>();
+    r.value = reader.template read<double>();
+}
+
+template <class Writer>
+void write_record(Writer& writer, const record& r)
+{
+    writer.write(r.type);
+    writer.write(r.flags);
+    writer.write(r.length);
+    writer.write(r.id);
+    writer.write(r.value);
+}
+
+} // namespace
+
+int main()
+{
+    benchmark::suite suite("byte_io");
+
+    const std::size_t count = 1 << 16;
+    std::vector<record> records(count);
+    for (std::size_t i = 0; i < count; ++i)
+        records[i] = {static_cast<std::uint16_t>(i), 3, static_cast<std::uint32_t>(i * 7), i * 1000003,
+                      static_cast<double>(i) * 0.5};
+    std::vector<byte> wire(count * static_cast<std::size_t>(record_size));
+    std::vector<record> decoded(count);
+
+    suite.run("encode records, by hand", count, [&] {
+        encode_by_hand(records, wire);
+        benchmark::do_not_optimize(wire[wire.size() - 1]);
+    });
+    suite.run("encode records, byte_writer", count, [&] {
+        byte_writer w(wire, endian::big);
+        for (const auto& r : records) write_record(w, r);
+        benchmark::do_not_optimize(wire[wire.size() - 1]);
+    });
+    suite.run("encode records, byte_writer batch per record", count, [&] {
+        byte_writer w(wire, endian::big);
+        for (const auto& r : records) {
+            auto b = w.batch(record_size);
+            write_record(b, r);
+        }
+        benchmark::do_not_optimize(wire[wire.size() - 1]);
+    });
+
+    suite.run("decode records, by hand", count, [&] {
+        benchmark::do_not_optimize(decode_by_hand(wire, decoded));
+        benchmark::do_not_optimize(decoded[count - 1]);
+    });
+    suite.run("decode records, byte_reader", count, [&] {
+        byte_reader reader(wire, endian::big);
+        for (auto& r : decoded) read_record(reader, r);
+        benchmark::do_not_optimize(decoded[count - 1]);
+    });
+    suite.run("decode records, byte_reader batch per record", count, [&] {
+        byte_reader reader(wire, endian::big);
+        for (auto& r : decoded) {
+            auto b = reader.batch(record_size);
+            read_record(b, r);
+        }
+        benchmark::do_not_optimize(decoded[count - 1]);
+    });
+
+    // bulk arrays: one length check and one swapping copy loop
+    const std::size_t words = 1 << 18;
+    std::vector<std::uint32_t> values(words, 0x01020304u);
+    std::vector<byte> raw(words * 4);
+    suite.run("encode uint32 array, by hand", words, [&] {
+        for (std::size_t i = 0; i < words; ++i) store_big(raw.data() + i * 4, values[i]);
+        benchmark::do_not_optimize(raw[0]);
+    });
+    suite.run("encode uint32 array, write_array", words, [&] {
+        byte_writer w(raw, endian::big);
+        w.write_array(span<const std::uint32_t>(values));
+        benchmark::do_not_optimize(raw[0]);
+    });
+    suite.run("decode uint32 array, by hand", words, [&] {
+        for (std::size_t i = 0; i < words; ++i) values[i] = load_big<std::uint32_t>(raw.data() + i * 4);
+        benchmark::do_not_optimize(values[0]);
+    });
+    suite.run("decode uint32 array, read_array", words, [&] {
+        byte_reader r(raw, endian::big);
+        r.read_array(span<std::uint32_t>(values));
+        benchmark::do_not_optimize(values[0]);
+    });
+
+    suite.write_json();
+    return 0;
+}
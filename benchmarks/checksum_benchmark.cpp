@@ -0,0 +1,70 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/checksum>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+
+// the usual table-driven loop, one byte per lookup
+std::uint32_t crc32c_bytewise(const std::vector<byte>& data, std::size_t n)
+{
+    const auto& table = details::crc32c_table().slice[0];
+    std::uint32_t crc = ~0u;
+    for (std::size_t i = 0; i < n; ++i)
+        crc = table[(crc ^ static_cast<std::uint32_t>(data[i])) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+} // namespace
+
+int main()
+{
+    benchmark::suite suite("checksum");
+
+    std::vector<byte> data(std::size_t(1) << 20);
+    std::mt19937 rng(42);
+    for (auto& b : data) b = static_cast<byte>(rng());
+
+    for (std::size_t size : {std::size_t(64), std::size_t(4) << 10, std::size_t(1) << 20}) {
+        const std::string bytes = std::to_string(size) + " bytes";
+        const span<const byte> s = span<const byte>(data).first(static_cast<std::ptrdiff_t>(size));
+
+        suite.run("crc32c, byte table, " + bytes, size, [&] {
+            benchmark::do_not_optimize(crc32c_bytewise(data, size));
+        });
+        suite.run("crc32c, slicing-by-8, " + bytes, size, [&] {
+            benchmark::do_not_optimize(~details::crc32c_update(details::simd_level::scalar, ~0u,
+                                                               s.data(), size));
+        });
+        suite.run("crc32c, dispatched, " + bytes, size, [&] {
+            benchmark::do_not_optimize(crc32c(s));
+        });
+    }
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/gsl_parallel>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+// usage: copy_benchmark [max size in MiB, default 256]
+int main(int argc, char* argv[])
+{
+    const std::size_t max_bytes =
+        (argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 256) << 20;
+
+    std::vector<unsigned char> src(max_bytes, 1);
+    std::vector<unsigned char> dst(max_bytes);
+
+    parallel_policy sequential_streaming(1);
+    sequential_streaming.streaming_threshold = 0;
+
+    parallel_policy parallel_cached;
+    parallel_cached.streaming_threshold = ~std::size_t(0);
+
+    parallel_policy parallel_default;
+
+    // items are bytes, so items / ns is the throughput in GB/s
+    benchmark::suite suite("copy");
+    for (std::size_t bytes = 4 << 10; bytes <= max_bytes; bytes *= 4) {
+        const span<const unsigned char> s(src.data(), static_cast<std::ptrdiff_t>(bytes));
+        const span<unsigned char> d(dst.data(), static_cast<std::ptrdiff_t>(bytes));
+        const int repetitions = bytes >= (64 << 20) ? 5 : 25;
+        const std::string size_class = " " + std::to_string(bytes >> 10) + " KiB";
+
+        const auto run = [&](const char* name, const parallel_policy* policy) {
+            suite.run(std::string("copy ") + name + size_class, bytes,
+                      [&] {
+                          if (policy)
+                              gsl::copy(*policy, s, d);
+                          else
+                              gsl::copy(s, d);
+                          benchmark::do_not_optimize(dst[bytes - 1]);
+                      },
+                      repetitions);
+        };
+        run("sequential", nullptr);
+        run("sequential streaming", &sequential_streaming);
+        run("parallel", &parallel_cached);
+        run("parallel default policy", &parallel_default);
+
+        suite.run("fill parallel default policy" + size_class, bytes,
+                  [&] { gsl::fill(parallel_default, d, 7); }, repetitions);
+        suite.run("move parallel default policy" + size_class, bytes,
+                  [&] { gsl::move(parallel_default, span<unsigned char>(src.data(), d.size()), d); },
+                  repetitions);
+    }
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,71 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/gsl_algorithm>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+// gather() against loops of at() and of unchecked table lookups
+template <class T, class Index>
+void run(benchmark::suite& suite, const char* types, std::size_t table_size)
+{
+    const std::size_t count = 1 << 20;
+    std::vector<T> table(table_size, T{3});
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<std::size_t> dist(0, table_size - 1);
+    std::vector<Index> indices(count);
+    for (auto& i : indices) i = static_cast<Index>(dist(rng));
+    std::vector<T> out(count);
+
+    const auto suffix = std::string(" ") + types + ", table of " + std::to_string(table_size);
+    suite.run("unchecked loop" + suffix, count, [&] {
+        for (std::size_t i = 0; i < count; ++i) out[i] = table[static_cast<std::size_t>(indices[i])];
+        benchmark::do_not_optimize(out[count - 1]);
+    });
+    suite.run("at() loop" + suffix, count, [&] {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = at(table, static_cast<std::ptrdiff_t>(indices[i]));
+        benchmark::do_not_optimize(out[count - 1]);
+    });
+    suite.run("gather()" + suffix, count, [&] {
+        gather(span<const T>(table), span<const Index>(indices), span<T>(out));
+        benchmark::do_not_optimize(out[count - 1]);
+    });
+    suite.run("scatter()" + suffix, count, [&] {
+        scatter(span<const T>(out), span<const Index>(indices), span<T>(table));
+        benchmark::do_not_optimize(table[0]);
+    });
+}
+
+int main()
+{
+    benchmark::suite suite("gather");
+    for (std::size_t table_size : {std::size_t(1) << 10, std::size_t(1) << 22}) {
+        run<std::int32_t, std::int32_t>(suite, "int32 by int32", table_size);
+        run<float, std::uint32_t>(suite, "float by uint32", table_size);
+        run<double, std::int64_t>(suite, "double by int64", table_size);
+        run<std::int64_t, std::int32_t>(suite, "int64 by int32", table_size);
+    }
+    suite.write_json();
+    return 0;
+}
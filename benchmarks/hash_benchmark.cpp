@@ -0,0 +1,87 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/hash>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace gsl;
+
+int main()
+{
+    benchmark::suite suite("hash");
+
+    for (std::size_t size : {std::size_t(8), std::size_t(32), std::size_t(256), std::size_t(4096)}) {
+        const std::string bytes = std::to_string(size) + " bytes";
+        const std::string text(size, 'x');
+        const cstring_span<> view(text);
+        const int repeat = static_cast<int>((1 << 20) / size);
+
+        suite.run("std::hash<std::string>, " + bytes, size * static_cast<std::size_t>(repeat), [&] {
+            std::size_t h = 0;
+            for (int i = 0; i < repeat; ++i) h += std::hash<std::string>{}(text);
+            benchmark::do_not_optimize(h);
+        });
+        suite.run("std::hash<cstring_span<>>, " + bytes, size * static_cast<std::size_t>(repeat), [&] {
+            std::size_t h = 0;
+            for (int i = 0; i < repeat; ++i) h += std::hash<cstring_span<>>{}(view);
+            benchmark::do_not_optimize(h);
+        });
+    }
+
+    // a cache keyed by short strings, looked up with views into a larger buffer
+    const std::size_t keys = 10000;
+    std::vector<std::string> names(keys);
+    std::string lookups;
+    std::mt19937 rng(42);
+    for (std::size_t i = 0; i < keys; ++i) names[i] = "config.section" + std::to_string(i) + ".value";
+    std::vector<cstring_span<>> queries;
+    for (std::size_t i = 0; i < keys; ++i) lookups += names[rng() % keys];
+    for (std::size_t pos = 0, i = 0; i < keys; ++i) {
+        const auto end = lookups.find(".value", pos) + 6;
+        queries.emplace_back(lookups.data() + pos, static_cast<std::ptrdiff_t>(end - pos));
+        pos = end;
+    }
+
+    std::unordered_map<std::string, std::size_t> by_string;
+    std::unordered_map<cstring_span<>, std::size_t> by_view;
+    for (std::size_t i = 0; i < keys; ++i) {
+        by_string[names[i]] = i;
+        by_view[names[i]] = i;
+    }
+
+    suite.run("lookup, unordered_map<string> with to_string", keys, [&] {
+        std::size_t sum = 0;
+        for (const auto& q : queries) sum += by_string.find(to_string(q))->second;
+        benchmark::do_not_optimize(sum);
+    });
+    suite.run("lookup, unordered_map<cstring_span>", keys, [&] {
+        std::size_t sum = 0;
+        for (const auto& q : queries) sum += by_view.find(q)->second;
+        benchmark::do_not_optimize(sum);
+    });
+
+    suite.write_json();
+    return 0;
+}
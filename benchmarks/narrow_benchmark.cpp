@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/gsl_algorithm>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+// narrow_copy() against a loop of narrow() calls and an unchecked conversion loop
+int main()
+{
+    benchmark::suite suite("narrow");
+
+    // one size that stays in the L2 cache and one that streams from memory
+    for (std::size_t element_count : {std::size_t(16) << 10, std::size_t(4) << 20}) {
+        std::vector<std::int64_t> src(element_count);
+        std::iota(src.begin(), src.end(), -static_cast<std::int64_t>(element_count / 2));
+        std::vector<std::int32_t> dest(element_count);
+
+        const span<const std::int64_t> s = src;
+        const span<std::int32_t> d = dest;
+        const auto suffix = " " + std::to_string(element_count >> 10) + "K elements";
+
+        suite.run("unchecked static_cast loop" + suffix, element_count, [&] {
+            for (std::size_t i = 0; i < element_count; ++i) dest[i] = static_cast<std::int32_t>(src[i]);
+            benchmark::do_not_optimize(dest[element_count - 1]);
+        });
+        suite.run("narrow() per element" + suffix, element_count, [&] {
+            for (std::size_t i = 0; i < element_count; ++i) dest[i] = narrow<std::int32_t>(src[i]);
+            benchmark::do_not_optimize(dest[element_count - 1]);
+        });
+        suite.run("try_narrow() per element" + suffix, element_count, [&] {
+            bool ok = true;
+            for (std::size_t i = 0; i < element_count; ++i) ok &= try_narrow(src[i], dest[i]);
+            benchmark::do_not_optimize(ok);
+        });
+        suite.run("narrow_copy()" + suffix, element_count, [&] {
+            benchmark::do_not_optimize(narrow_copy(s, d));
+            benchmark::do_not_optimize(dest[element_count - 1]);
+        });
+    }
+
+    suite.write_json();
+    return 0;
+}
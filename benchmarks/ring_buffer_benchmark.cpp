@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "benchmark.h"
+
+#include <gsl/ring_buffer>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gsl;
+
+// moves `total` integers from a producer thread to a consumer thread in chunks of up
+// to `chunk` elements and returns their sum, which the consumer computes
+template <class Producer, class Consumer>
+std::uint64_t transfer(Producer produce, Consumer consume)
+{
+    std::uint64_t sum = 0;
+    std::thread producer(produce);
+    consume(sum);
+    producer.join();
+    return sum;
+}
+
+void run(benchmark::suite& suite, std::ptrdiff_t capacity, std::uint32_t chunk)
+{
+    const std::uint32_t total = 1 << 22;
+    const auto suffix = ", capacity " + std::to_string(capacity) + ", chunks of " + std::to_string(chunk);
+
+    // the ring buffer's own windows: elements are written and read in place
+    suite.run("spsc_ring_buffer prepare/peek" + suffix, total, [&] {
+        spsc_ring_buffer<std::uint32_t> ring(capacity);
+        const auto sum = transfer(
+            [&] {
+                std::uint32_t next = 0;
+                while (next < total) {
+                    auto w = ring.prepare((std::min)(chunk, total - next));
+                    if (w.empty()) std::this_thread::yield();
+                    for (auto& x : w.first) x = next++;
+                    for (auto& x : w.second) x = next++;
+                    ring.commit(w.size());
+                }
+            },
+            [&](std::uint64_t& s) {
+                std::uint32_t received = 0;
+                while (received < total) {
+                    auto r = ring.peek(chunk);
+                    if (r.empty()) std::this_thread::yield();
+                    for (auto x : r.first) s += x;
+                    for (auto x : r.second) s += x;
+                    received += static_cast<std::uint32_t>(r.size());
+                    ring.consume(r.size());
+                }
+            });
+        benchmark::do_not_optimize(sum);
+    }, 5);
+
+    // copying chunks in and out, as with a std::vector hand-off
+    suite.run("spsc_ring_buffer write/read" + suffix, total, [&] {
+        spsc_ring_buffer<std::uint32_t> ring(capacity);
+        const auto sum = transfer(
+            [&] {
+                std::vector<std::uint32_t> buffer(chunk);
+                std::uint32_t next = 0;
+                while (next < total) {
+                    const auto n = (std::min)(chunk, total - next);
+                    for (std::uint32_t i = 0; i < n; ++i) buffer[i] = next + i;
+                    std::ptrdiff_t written = 0;
+                    while (written < n) {
+                        const auto w = ring.write(span<const std::uint32_t>(buffer).subspan(written, n - written));
+                        if (w == 0) std::this_thread::yield();
+                        written += w;
+                    }
+                    next += n;
+                }
+            },
+            [&](std::uint64_t& s) {
+                std::vector<std::uint32_t> buffer(chunk);
+                std::uint32_t received = 0;
+                while (received < total) {
+                    const auto n = ring.read(buffer);
+                    if (n == 0) std::this_thread::yield();
+                    for (std::ptrdiff_t i = 0; i < n; ++i) s += buffer[static_cast<std::size_t>(i)];
+                    received += static_cast<std::uint32_t>(n);
+                }
+            });
+        benchmark::do_not_optimize(sum);
+    }, 5);
+
+    // the baseline: chunks copied into std::vectors handed over under a mutex
+    suite.run("mutex + std::vector hand-off" + suffix, total, [&] {
+        std::mutex m;
+        std::condition_variable cv;
+        std::vector<std::vector<std::uint32_t>> queue;
+        std::size_t queued = 0;
+        const auto limit = static_cast<std::size_t>(capacity);
+        const auto sum = transfer(
+            [&] {
+                std::uint32_t next = 0;
+                while (next < total) {
+                    const auto n = (std::min)(chunk, total - next);
+                    std::vector<std::uint32_t> buffer(n);
+                    for (std::uint32_t i = 0; i < n; ++i) buffer[i] = next + i;
+                    std::unique_lock<std::mutex> lock(m);
+                    cv.wait(lock, [&] { return queued + n <= limit; });
+                    queued += n;
+                    queue.push_back(std::move(buffer));
+                    cv.notify_all();
+                    next += n;
+                }
+            },
+            [&](std::uint64_t& s) {
+                std::uint32_t received = 0;
+                std::vector<std::vector<std::uint32_t>> batch;
+                while (received < total) {
+                    {
+                        std::unique_lock<std::mutex> lock(m);
+                        cv.wait(lock, [&] { return !queue.empty(); });
+                        batch.swap(queue);
+                        queued = 0;
+                        cv.notify_all();
+                    }
+                    for (const auto& buffer : batch) {
+                        for (auto x : buffer) s += x;
+                        received += static_cast<std::uint32_t>(buffer.size());
+                    }
+                    batch.clear();
+                }
+            });
+        benchmark::do_not_optimize(sum);
+    }, 5);
+}
+
+int main()
+{
+    benchmark::suite suite("ring_buffer");
+    suite.set("hardware_threads", std::to_string(std::thread::hardware_concurrency()));
+    run(suite, 1 << 12, 64);
+    run(suite, 1 << 16, 1024);
+    suite.write_json();
+    return 0;
+}
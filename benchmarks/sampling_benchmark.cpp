@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/span>
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+//
+// Overhead of GSL_SAMPLED_ON_CONTRACT_VIOLATION on span iteration and indexing for a
+// range of sampling periods, against a raw pointer loop. Built in sampled mode only;
+// compare with view_benchmark_throw and view_benchmark_unenforced for the extremes.
+//
+namespace
+{
+const std::ptrdiff_t element_count = 1 << 20;
+
+int sum_pointer(const int* first, const int* last)
+{
+    int sum = 0;
+    for (; first != last; ++first) sum += *first;
+    return sum;
+}
+
+int sum_range_for(span<const int> s)
+{
+    int sum = 0;
+    for (auto n : s) sum += n;
+    return sum;
+}
+
+int sum_index(span<const int> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+}
+
+int main()
+{
+    std::vector<int> v(static_cast<std::size_t>(element_count));
+    std::iota(v.begin(), v.end(), 0);
+    const span<const int> s = v;
+    const auto count = static_cast<std::size_t>(element_count);
+
+    benchmark::suite suite("contract_sampling");
+    suite.run("raw pointer loop", count,
+              [&] { benchmark::do_not_optimize(sum_pointer(v.data(), v.data() + v.size())); });
+
+    for (unsigned period : {1u, 10u, 100u, 1000u, 10000u}) {
+        set_contract_sampling_period(period);
+        const auto suffix = " (N = " + std::to_string(period) + ")";
+        suite.run("span range-for" + suffix, count, [&] { benchmark::do_not_optimize(sum_range_for(s)); });
+        suite.run("span operator[]" + suffix, count, [&] { benchmark::do_not_optimize(sum_index(s)); });
+    }
+
+    suite.write_json();
+    return 0;
+}
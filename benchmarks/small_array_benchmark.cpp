@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include "benchmark.h"
+
+#include <gsl/stack_array>
+
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gsl;
+
+// one "request": fill a temporary buffer and fold it
+template <class Buffer>
+std::uint32_t handle(Buffer& buffer)
+{
+    std::uint8_t* p = buffer.data();
+    const std::ptrdiff_t n = buffer.size();
+    for (std::ptrdiff_t i = 0; i < n; ++i) p[i] = static_cast<std::uint8_t>(i);
+    benchmark::do_not_optimize(p[0]);
+    std::uint32_t h = 0;
+    for (std::ptrdiff_t i = 0; i < n; ++i) h += p[i];
+    return h;
+}
+
+template <class F>
+void on_threads(unsigned threads, F f)
+{
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) workers.emplace_back(f);
+    for (auto& w : workers) w.join();
+}
+
+// temporary request buffers from the heap, inline storage and a per-thread arena
+void run(benchmark::suite& suite, std::ptrdiff_t size, unsigned threads)
+{
+    const int requests = 100000;
+    const std::size_t items = static_cast<std::size_t>(requests) * threads;
+    const auto suffix = ", " + std::to_string(size) + " bytes, " + std::to_string(threads) + " threads";
+
+    suite.run("std::vector" + suffix, items, [&] {
+        on_threads(threads, [&] {
+            std::uint32_t h = 0;
+            for (int r = 0; r < requests; ++r) {
+                std::vector<std::uint8_t> buffer(static_cast<std::size_t>(size));
+                h += handle(buffer);
+            }
+            benchmark::do_not_optimize(h);
+        });
+    }, 5);
+    suite.run("dyn_array default_init" + suffix, items, [&] {
+        on_threads(threads, [&] {
+            std::uint32_t h = 0;
+            for (int r = 0; r < requests; ++r) {
+                dyn_array<std::uint8_t> buffer(size, default_init);
+                h += handle(buffer);
+            }
+            benchmark::do_not_optimize(h);
+        });
+    }, 5);
+    suite.run("small_array<256> default_init" + suffix, items, [&] {
+        on_threads(threads, [&] {
+            std::uint32_t h = 0;
+            for (int r = 0; r < requests; ++r) {
+                small_array<std::uint8_t, 256> buffer(size, default_init);
+                h += handle(buffer);
+            }
+            benchmark::do_not_optimize(h);
+        });
+    }, 5);
+    suite.run("small_array<16> + arena" + suffix, items, [&] {
+        on_threads(threads, [&] {
+            std::vector<byte> storage(1 << 16);
+            arena scratch(storage);
+            std::uint32_t h = 0;
+            for (int r = 0; r < requests; ++r) {
+                small_array<std::uint8_t, 16, arena_allocator<std::uint8_t>> buffer(
+                    size, default_init, arena_allocator<std::uint8_t>(scratch));
+                h += handle(buffer);
+                scratch.reset();
+            }
+            benchmark::do_not_optimize(h);
+        });
+    }, 5);
+}
+
+int main()
+{
+    benchmark::suite suite("small_array");
+    const unsigned hardware = std::thread::hardware_concurrency();
+    suite.set("hardware_threads", std::to_string(hardware));
+    for (std::ptrdiff_t size : {32, 200}) {
+        run(suite, size, 1);
+        if (hardware > 1) run(suite, size, hardware);
+    }
+    suite.write_json();
+    return 0;
+}
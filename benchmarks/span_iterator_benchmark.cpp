@@ -0,0 +1,84 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/span>
+
+#include <numeric>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+const std::size_t element_count = 1 << 20;
+
+int sum_pointer(const int* first, const int* last)
+{
+    int sum = 0;
+    for (; first != last; ++first) sum += *first;
+    return sum;
+}
+
+int sum_range_for(span<const int> s)
+{
+    int sum = 0;
+    for (auto n : s) sum += n;
+    return sum;
+}
+
+int sum_index(span<const int> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+
+int sum_subspan_iterator(span<const int> s)
+{
+    int sum = 0;
+    const auto last = s.subspan(1).end();
+    for (auto it = s.subspan(1).begin(); it != last; ++it) sum += *it;
+    return sum;
+}
+}
+
+int main()
+{
+    std::vector<int> v(element_count);
+    std::iota(v.begin(), v.end(), 0);
+    span<const int> s = v;
+
+    benchmark::suite suite("span_iterator");
+#ifdef GSL_SPAN_POINTER_ITERATORS
+    suite.set("span_iterators", "pointer");
+#else
+    suite.set("span_iterators", "checked");
+#endif
+
+    suite.run("raw pointer loop", element_count,
+              [&] { benchmark::do_not_optimize(sum_pointer(v.data(), v.data() + v.size())); });
+    suite.run("span range-for", element_count,
+              [&] { benchmark::do_not_optimize(sum_range_for(s)); });
+    suite.run("span operator[]", element_count,
+              [&] { benchmark::do_not_optimize(sum_index(s)); });
+    suite.run("subspan iterator", element_count - 1,
+              [&] { benchmark::do_not_optimize(sum_subspan_iterator(s)); });
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,131 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/string_span>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+    // what the operators did before: checked iterators and the standard algorithms
+    bool iterator_equal(cstring_span<> l, cstring_span<> r)
+    {
+        return std::equal(l.begin(), l.end(), r.begin(), r.end());
+    }
+
+    bool iterator_less(cstring_span<> l, cstring_span<> r)
+    {
+        return std::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+    }
+
+    struct record
+    {
+        cstring_span<> name;
+        int id;
+    };
+}
+
+int main()
+{
+    benchmark::suite suite("string_compare");
+
+    for (std::size_t size : {std::size_t(8), std::size_t(32), std::size_t(256), std::size_t(4096)}) {
+        const std::string chars = std::to_string(size) + " chars";
+        const int repeat = static_cast<int>((1 << 22) / size);
+        const std::size_t items = size * static_cast<std::size_t>(repeat);
+
+        // equal strings, the worst case for both operators
+        const std::string a(size, 'x'), b(size, 'x');
+        const cstring_span<> l = a, r = b;
+
+        suite.run("== checked iterators, " + chars, items, [&] {
+            int n = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(l);
+                n += iterator_equal(l, r);
+            }
+            benchmark::do_not_optimize(n);
+        });
+        suite.run("== operator, " + chars, items, [&] {
+            int n = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(l);
+                n += l == r;
+            }
+            benchmark::do_not_optimize(n);
+        });
+        suite.run("< checked iterators, " + chars, items, [&] {
+            int n = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(l);
+                n += iterator_less(l, r);
+            }
+            benchmark::do_not_optimize(n);
+        });
+        suite.run("< operator, " + chars, items, [&] {
+            int n = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(l);
+                n += l < r;
+            }
+            benchmark::do_not_optimize(n);
+        });
+        suite.run("std::string <, " + chars, items, [&] {
+            int n = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(a);
+                n += a < b;
+            }
+            benchmark::do_not_optimize(n);
+        });
+    }
+
+    // sorting records by name, then id: names share long prefixes and repeat often
+    std::mt19937 rng(42);
+    std::vector<std::string> names;
+    for (int i = 0; i < 200; ++i) names.push_back("/var/log/service/instance-" + std::to_string(rng() % 50) + ".log");
+    std::vector<record> records;
+    for (int i = 0; i < 100000; ++i) records.push_back({names[rng() % names.size()], static_cast<int>(rng() % 1000)});
+
+    suite.run("sort by name, id: != then <", records.size(), [&] {
+        auto v = records;
+        std::sort(v.begin(), v.end(), [](const record& x, const record& y) {
+            if (x.name != y.name) return x.name < y.name;
+            return x.id < y.id;
+        });
+        benchmark::do_not_optimize(v.front().id);
+    }, 5);
+    suite.run("sort by name, id: compare()", records.size(), [&] {
+        auto v = records;
+        std::sort(v.begin(), v.end(), [](const record& x, const record& y) {
+            const int cmp = x.name.compare(y.name);
+            return cmp != 0 ? cmp < 0 : x.id < y.id;
+        });
+        benchmark::do_not_optimize(v.front().id);
+    }, 5);
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/string_span>
+
+#include <cstddef>
+#include <cstring>
+#include <cwchar>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+    // the bounds-checked loop ensure_z used before
+    std::ptrdiff_t span_loop_length(const char* str, std::ptrdiff_t n)
+    {
+        span<const char> str_span{str, n};
+        std::ptrdiff_t len = 0;
+        while (len < n && str_span[len]) len++;
+        return len;
+    }
+}
+
+int main()
+{
+    benchmark::suite suite("string_length");
+
+    for (std::size_t size : {std::size_t(8), std::size_t(32), std::size_t(256), std::size_t(4096)}) {
+        const std::string chars = std::to_string(size) + " chars";
+        const int repeat = static_cast<int>((1 << 22) / (size + 1));
+        const std::size_t items = size * static_cast<std::size_t>(repeat);
+
+        // several strings at different alignments, like fields of a parsed buffer
+        std::vector<char> buffer(8 * (size + 1) + 8, 'x');
+        std::vector<const char*> strings;
+        for (std::size_t i = 0; i < 8; ++i) {
+            buffer[i * (size + 1) + i + size] = '\0';
+            strings.push_back(buffer.data() + i * (size + 1) + i);
+        }
+        std::vector<std::wstring> wide(8, std::wstring(size, L'x'));
+
+        suite.run("span loop, " + chars, items, [&] {
+            std::ptrdiff_t total = 0;
+            for (int i = 0; i < repeat; ++i) total += span_loop_length(strings[i % 8], PTRDIFF_MAX);
+            benchmark::do_not_optimize(total);
+        });
+        suite.run("std::strlen, " + chars, items, [&] {
+            std::size_t total = 0;
+            for (int i = 0; i < repeat; ++i) total += std::strlen(strings[i % 8]);
+            benchmark::do_not_optimize(total);
+        });
+        suite.run("ensure_z, " + chars, items, [&] {
+            std::ptrdiff_t total = 0;
+            for (int i = 0; i < repeat; ++i) total += ensure_z(strings[i % 8]).size();
+            benchmark::do_not_optimize(total);
+        });
+        suite.run("ensure_sentinel<char, '\\0'>, " + chars, items, [&] {
+            std::ptrdiff_t total = 0;
+            for (int i = 0; i < repeat; ++i) total += ensure_sentinel<const char, '\0'>(strings[i % 8]).size();
+            benchmark::do_not_optimize(total);
+        });
+
+        // a zero-terminated view passed through layers that each want the string
+        czstring_span<> zspan({strings[0], static_cast<std::ptrdiff_t>(size + 1)});
+        suite.run("czstring_span::ensure_z (cached), " + chars, items, [&] {
+            std::ptrdiff_t total = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(zspan);
+                total += zspan.ensure_z().size();
+            }
+            benchmark::do_not_optimize(total);
+        });
+        suite.run("czstring_span::rescan_z, " + chars, items, [&] {
+            std::ptrdiff_t total = 0;
+            for (int i = 0; i < repeat; ++i) {
+                benchmark::do_not_optimize(zspan);
+                total += zspan.rescan_z().size();
+            }
+            benchmark::do_not_optimize(total);
+        });
+
+        suite.run("std::wcslen, " + chars, items, [&] {
+            std::size_t total = 0;
+            for (int i = 0; i < repeat; ++i) total += std::wcslen(wide[i % 8].c_str());
+            benchmark::do_not_optimize(total);
+        });
+        suite.run("ensure_z(const wchar_t*), " + chars, items, [&] {
+            std::ptrdiff_t total = 0;
+            for (int i = 0; i < repeat; ++i) total += ensure_z(wide[i % 8].c_str()).size();
+            benchmark::do_not_optimize(total);
+        });
+    }
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,139 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/string_split>
+
+#include <cstddef>
+#include <random>
+#include <string>
+
+using namespace gsl;
+
+namespace
+{
+    // access-log lines of 60-110 characters, seven space-separated fields each
+    std::string make_log(std::size_t size)
+    {
+        static const char* const methods[] = {"GET", "POST", "PUT", "DELETE"};
+        static const char* const statuses[] = {"200", "200", "200", "304", "404", "500"};
+        std::mt19937 rng(42);
+        std::string log;
+        log.reserve(size + 256);
+        while (log.size() < size) {
+            log += "2026-10-17T12:" + std::to_string(rng() % 60) + ":" + std::to_string(rng() % 60) + "Z";
+            log += " host-" + std::to_string(rng() % 64);
+            log += ' ';
+            log += methods[rng() % 4];
+            log += " /api/v1/items/" + std::to_string(rng() % 100000);
+            if (rng() % 3 == 0) log += "/details?expand=" + std::to_string(rng());
+            log += ' ';
+            log += statuses[rng() % 6];
+            log += ' ' + std::to_string(rng() % 50000);
+            log += " 0." + std::to_string(rng() % 10000) + "\n";
+        }
+        return log;
+    }
+
+    // the per-line work: the number of 5xx responses
+    bool is_server_error(const char* status, std::size_t size)
+    {
+        return size == 3 && status[0] == '5';
+    }
+}
+
+int main()
+{
+    benchmark::suite suite("string_split");
+
+    const std::size_t log_size = std::size_t(64) << 20;
+    const std::string log = make_log(log_size);
+    const cstring_span<> view = log;
+    const int repetitions = 5;
+
+    // copies every line and field, as a parser built on std::string does
+    suite.run("std::string::find + substr", log.size(), [&] {
+        std::size_t errors = 0;
+        std::string::size_type pos = 0;
+        while (pos < log.size()) {
+            auto eol = log.find('\n', pos);
+            if (eol == std::string::npos) eol = log.size();
+            const std::string line = log.substr(pos, eol - pos);
+            std::string::size_type field_pos = 0;
+            for (int field = 0;; ++field) {
+                auto end = line.find(' ', field_pos);
+                const std::string value = line.substr(field_pos, end - field_pos);
+                if (field == 4 && is_server_error(value.data(), value.size())) ++errors;
+                if (end == std::string::npos) break;
+                field_pos = end + 1;
+            }
+            pos = eol + 1;
+        }
+        benchmark::do_not_optimize(errors);
+    }, repetitions);
+
+    // the same searches without the copies
+    suite.run("std::string::find positions", log.size(), [&] {
+        std::size_t errors = 0;
+        std::string::size_type pos = 0;
+        while (pos < log.size()) {
+            auto eol = log.find('\n', pos);
+            if (eol == std::string::npos) eol = log.size();
+            std::string::size_type field_pos = pos;
+            for (int field = 0;; ++field) {
+                auto end = log.find(' ', field_pos);
+                if (end == std::string::npos || end > eol) end = eol;
+                if (field == 4 && is_server_error(log.data() + field_pos, end - field_pos)) ++errors;
+                if (end == eol) break;
+                field_pos = end + 1;
+            }
+            pos = eol + 1;
+        }
+        benchmark::do_not_optimize(errors);
+    }, repetitions);
+
+    suite.run("lines() + split()", log.size(), [&] {
+        std::size_t errors = 0;
+        for (cstring_span<> line : lines(view)) {
+            int field = 0;
+            for (cstring_span<> value : split(line, ' ')) {
+                if (field++ == 4 && is_server_error(value.data(), static_cast<std::size_t>(value.size())))
+                    ++errors;
+            }
+        }
+        benchmark::do_not_optimize(errors);
+    }, repetitions);
+
+    // fields and line ends in one pass
+    suite.run("split_any(\" \\n\")", log.size(), [&] {
+        std::size_t errors = 0;
+        int field = 0;
+        const char* line_start = view.data();
+        for (cstring_span<> value : split_any(view, " \n")) {
+            if (value.data() == line_start) field = 0;
+            if (field++ == 4 && is_server_error(value.data(), static_cast<std::size_t>(value.size())))
+                ++errors;
+            const char* after = value.data() + value.size();
+            if (after < view.data() + view.size() && *after == '\n') line_start = after + 1;
+        }
+        benchmark::do_not_optimize(errors);
+    }, repetitions);
+
+    suite.write_json();
+    return 0;
+}
@@ -0,0 +1,110 @@
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/varint>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+
+// the usual one-value-at-a-time decoding loop
+template <class T>
+std::ptrdiff_t decode_by_hand(const std::vector<byte>& in, std::ptrdiff_t in_size, std::vector<T>& out)
+{
+    const byte* p = in.data();
+    const byte* end = p + in_size;
+    std::size_t count = 0;
+    while (p != end && count != out.size()) {
+        T value = 0;
+        int shift = 0;
+        std::uint8_t b;
+        do {
+            b = static_cast<std::uint8_t>(*p++);
+            value |= static_cast<T>(b & 0x7f) << shift;
+            shift += 7;
+        } while (b >= 0x80 && p != end);
+        out[count++] = value;
+    }
+    return static_cast<std::ptrdiff_t>(count);
+}
+
+// values whose encodings take 1 byte with probability one_byte and 1 to max_bytes bytes
+// otherwise
+std::vector<std::uint32_t> make_values(std::size_t n, int one_byte, int max_bytes)
+{
+    std::mt19937 rng(42);
+    std::vector<std::uint32_t> v(n);
+    for (auto& x : v) {
+        const int bytes = static_cast<int>(rng() % 100) < one_byte ? 1 : static_cast<int>(rng() % static_cast<unsigned>(max_bytes)) + 1;
+        const int bits = bytes == 5 ? 32 : 7 * bytes;
+        x = static_cast<std::uint32_t>(rng() & ((1ull << bits) - 1));
+    }
+    return v;
+}
+
+} // namespace
+
+int main()
+{
+    benchmark::suite suite("varint");
+
+    const std::size_t count = 1 << 16;
+    struct distribution
+    {
+        const char* name;
+        int one_byte;
+        int max_bytes;
+    };
+    const distribution distributions[] = {
+        {"1 byte", 100, 1}, {"mostly 1 byte", 90, 2}, {"1-2 bytes", 0, 2}, {"1-4 bytes", 0, 4}, {"1-5 bytes", 0, 5}};
+
+    for (const auto& d : distributions) {
+        const auto values = make_values(count, d.one_byte, d.max_bytes);
+        std::vector<byte> wire(count * max_varint32_size);
+        const std::ptrdiff_t size = encode_varints(values, wire).bytes;
+        std::vector<std::uint32_t> out32(count);
+        std::vector<std::uint64_t> out64(count);
+
+        suite.run(std::string("decode uint32, by hand, ") + d.name, count, [&] {
+            benchmark::do_not_optimize(decode_by_hand(wire, size, out32));
+            benchmark::do_not_optimize(out32[count - 1]);
+        });
+        suite.run(std::string("decode uint32, decode_varints, ") + d.name, count, [&] {
+            benchmark::do_not_optimize(decode_varints(span<const byte>(wire).first(size), out32));
+            benchmark::do_not_optimize(out32[count - 1]);
+        });
+        suite.run(std::string("decode uint64, decode_varints, ") + d.name, count, [&] {
+            benchmark::do_not_optimize(decode_varints(span<const byte>(wire).first(size), out64));
+            benchmark::do_not_optimize(out64[count - 1]);
+        });
+        suite.run(std::string("encode uint32, encode_varints, ") + d.name, count, [&] {
+            benchmark::do_not_optimize(encode_varints(values, wire));
+            benchmark::do_not_optimize(wire[0]);
+        });
+    }
+
+    suite.write_json();
+    return 0;
+}
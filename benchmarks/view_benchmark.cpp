@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "benchmark.h"
+
+#include <gsl/multi_span>
+#include <gsl/span>
+#include <gsl/string_span>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace gsl;
+
+//
+// Compares the cost of the GSL views against raw pointers for the common access
+// patterns: iteration, indexing, subspan creation, comparison and ensure_z.
+// The executable is built once per contract mode (see CMakeLists.txt), so the
+// overhead of the bounds checks can be read off directly from the JSON results.
+//
+namespace
+{
+const std::ptrdiff_t element_count = 1 << 20;
+const std::ptrdiff_t subspan_count = 1 << 16;
+const std::ptrdiff_t string_length = 1 << 12;
+
+std::vector<int> random_ints(std::size_t n)
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+    std::vector<int> v(n);
+    std::generate(v.begin(), v.end(), [&] { return dist(rng); });
+    return v;
+}
+
+std::string random_string(std::size_t n)
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> dist('a', 'z');
+    std::string s(n, ' ');
+    std::generate(s.begin(), s.end(), [&] { return static_cast<char>(dist(rng)); });
+    return s;
+}
+
+// iteration
+
+int iterate_pointer(const int* first, const int* last)
+{
+    int sum = 0;
+    for (; first != last; ++first) sum += *first;
+    return sum;
+}
+
+int iterate_span(span<const int> s)
+{
+    int sum = 0;
+    for (auto n : s) sum += n;
+    return sum;
+}
+
+int iterate_multi_span(multi_span<const int> s)
+{
+    int sum = 0;
+    for (auto n : s) sum += n;
+    return sum;
+}
+
+int iterate_strided_span(strided_span<const int, 1> s)
+{
+    int sum = 0;
+    for (auto n : s) sum += n;
+    return sum;
+}
+
+int iterate_string_span(cstring_span<> s)
+{
+    int sum = 0;
+    for (auto c : s) sum += c;
+    return sum;
+}
+
+// indexing
+
+int index_pointer(const int* p, std::ptrdiff_t n)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < n; ++i) sum += p[i];
+    return sum;
+}
+
+int index_span(span<const int> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+
+int index_multi_span(multi_span<const int> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+
+int index_strided_span(strided_span<const int, 1> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+
+int index_string_span(cstring_span<> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+    return sum;
+}
+
+// subspan: creates one small view per offset and reads its first element
+
+int subspan_pointer(const int* p, std::ptrdiff_t n)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i + 4 <= n; ++i) {
+        const int* sub = p + i;
+        sum += sub[0];
+    }
+    return sum;
+}
+
+int subspan_span(span<const int> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i + 4 <= s.size(); ++i) sum += s.subspan(i, 4)[0];
+    return sum;
+}
+
+int subspan_multi_span(multi_span<const int> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i + 4 <= s.size(); ++i) sum += s.subspan(i, 4)[0];
+    return sum;
+}
+
+int subspan_string_span(cstring_span<> s)
+{
+    int sum = 0;
+    for (std::ptrdiff_t i = 0; i + 4 <= s.size(); ++i) sum += s.subspan(i, 4)[0];
+    return sum;
+}
+}
+
+int main()
+{
+    const auto ints = random_ints(static_cast<std::size_t>(element_count));
+    const auto other_ints = ints;
+    const auto text = random_string(static_cast<std::size_t>(string_length));
+    const auto other_text = text;
+
+    const int* p = ints.data();
+    const span<const int> s = ints;
+    const multi_span<const int> ms = as_multi_span(p, element_count);
+    const strided_span<const int, 1> ss{p, element_count, {{element_count}, {1}}};
+    const cstring_span<> str = text;
+
+    const auto count = static_cast<std::size_t>(element_count);
+    const auto sub_count = static_cast<std::size_t>(subspan_count - 3);
+    const auto text_count = static_cast<std::size_t>(string_length);
+
+    benchmark::suite suite("views");
+
+    suite.run("iterate pointer", count, [&] { benchmark::do_not_optimize(iterate_pointer(p, p + element_count)); });
+    suite.run("iterate span", count, [&] { benchmark::do_not_optimize(iterate_span(s)); });
+    suite.run("iterate multi_span", count, [&] { benchmark::do_not_optimize(iterate_multi_span(ms)); });
+    suite.run("iterate strided_span", count, [&] { benchmark::do_not_optimize(iterate_strided_span(ss)); });
+    suite.run("iterate string pointer", text_count, [&] {
+        int sum = 0;
+        for (const char* c = text.data(); c != text.data() + text.size(); ++c) sum += *c;
+        benchmark::do_not_optimize(sum);
+    });
+    suite.run("iterate string_span", text_count, [&] { benchmark::do_not_optimize(iterate_string_span(str)); });
+
+    suite.run("index pointer", count, [&] { benchmark::do_not_optimize(index_pointer(p, element_count)); });
+    suite.run("index span", count, [&] { benchmark::do_not_optimize(index_span(s)); });
+    suite.run("index multi_span", count, [&] { benchmark::do_not_optimize(index_multi_span(ms)); });
+    suite.run("index strided_span", count, [&] { benchmark::do_not_optimize(index_strided_span(ss)); });
+    suite.run("index string_span", text_count, [&] { benchmark::do_not_optimize(index_string_span(str)); });
+
+    suite.run("subspan pointer", sub_count, [&] { benchmark::do_not_optimize(subspan_pointer(p, subspan_count)); });
+    suite.run("subspan span", sub_count, [&] { benchmark::do_not_optimize(subspan_span(s.first(subspan_count))); });
+    suite.run("subspan multi_span", sub_count,
+              [&] { benchmark::do_not_optimize(subspan_multi_span(ms.first(subspan_count))); });
+    suite.run("subspan string_span", text_count - 3, [&] { benchmark::do_not_optimize(subspan_string_span(str)); });
+
+    const span<const int> other_s = other_ints;
+    const cstring_span<> other_str = other_text;
+    suite.run("compare pointer", count, [&] {
+        benchmark::do_not_optimize(std::memcmp(p, other_ints.data(), count * sizeof(int)) == 0);
+    });
+    suite.run("compare span", count, [&] { benchmark::do_not_optimize(s == other_s); });
+    suite.run("compare string_span", text_count, [&] { benchmark::do_not_optimize(str == other_str); });
+
+    const char* sz = text.c_str();
+    suite.run("ensure_z strlen", text_count, [&] { benchmark::do_not_optimize(std::strlen(sz)); });
+    suite.run("ensure_z czstring", text_count, [&] { benchmark::do_not_optimize(ensure_z(sz).size()); });
+
+    suite.write_json();
+    return 0;
+}
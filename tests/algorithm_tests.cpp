@@ -18,6 +18,20 @@
 #include <gsl/gsl_algorithm>
 
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define GSL_TEST_HAS_MMAP
+#endif
 
 using namespace std;
 using namespace gsl;
@@ -204,6 +218,519 @@ SUITE(copy_tests)
         copy(src_span_static, dst_span_static);
 #endif
     }
+
+    TEST(move_tests)
+    {
+        {
+            std::vector<std::unique_ptr<int>> src;
+            for (int i = 0; i < 10; ++i) src.emplace_back(new int(i));
+            std::vector<std::unique_ptr<int>> dst(10);
+
+            move(span<std::unique_ptr<int>>(src), span<std::unique_ptr<int>>(dst));
+            for (std::size_t i = 0; i < src.size(); ++i) {
+                CHECK(src[i] == nullptr);
+                CHECK(*dst[i] == static_cast<int>(i));
+            }
+        }
+
+        {
+            std::array<int, 4> src{};
+            std::array<int, 2> dst{};
+            CHECK_THROW(move(span<int>(src), span<int>(dst)), fail_fast);
+        }
+    }
+
+    TEST(fill_tests)
+    {
+        {
+            std::array<int, 5> arr{};
+            fill(span<int>(arr).subspan(1, 3), 7);
+            CHECK((arr == std::array<int, 5>{0, 7, 7, 7, 0}));
+        }
+    }
+}
+
+namespace
+{
+    std::vector<details::simd_level> supported_simd_levels()
+    {
+        std::vector<details::simd_level> levels{details::simd_level::scalar};
+        if (details::cpu_simd_level() >= details::simd_level::sse2)
+            levels.push_back(details::simd_level::sse2);
+        if (details::cpu_simd_level() >= details::simd_level::sse42)
+            levels.push_back(details::simd_level::sse42);
+        if (details::cpu_simd_level() >= details::simd_level::avx2)
+            levels.push_back(details::simd_level::avx2);
+        if (details::cpu_simd_level() >= details::simd_level::avx512)
+            levels.push_back(details::simd_level::avx512);
+        return levels;
+    }
+
+    // small alphabet so that every algorithm finds matches
+    template <class T>
+    std::vector<T> random_elements(std::mt19937& rng, std::size_t n)
+    {
+        std::uniform_int_distribution<int> dist(0, 3);
+        std::vector<T> v(n);
+        for (auto& e : v) e = static_cast<T>(dist(rng));
+        return v;
+    }
+
+    template <class T>
+    bool check_search_algorithms()
+    {
+        std::mt19937 rng(42);
+        bool ok = true;
+        for (auto level : supported_simd_levels()) {
+            for (std::size_t n = 0; n < 300; n += (n < 70 ? 1 : 37)) {
+                const auto v = random_elements<T>(rng, n);
+                const T* p = v.data();
+                const auto size = static_cast<std::ptrdiff_t>(n);
+                const T value = static_cast<T>(3);
+
+                ok = ok && details::simd_find(level, p, size, value) ==
+                               std::find(v.begin(), v.end(), value) - v.begin();
+                ok = ok && details::simd_count(level, p, size, value) ==
+                               std::count(v.begin(), v.end(), value);
+
+                const T set[] = {static_cast<T>(2), static_cast<T>(3)};
+                ok = ok && details::simd_find_first_of(level, p, size, set, 2) ==
+                               std::find_first_of(v.begin(), v.end(), set, set + 2) - v.begin();
+
+                for (std::size_t m = 1; m < 5; ++m) {
+                    const auto needle = random_elements<T>(rng, m);
+                    const auto it = std::search(v.begin(), v.end(), needle.begin(), needle.end());
+                    ok = ok && details::simd_search(level, p, size, needle.data(),
+                                                    static_cast<std::ptrdiff_t>(m)) ==
+                                   it - v.begin();
+                }
+
+                auto w = v;
+                if (n > 0) w[(n / 2 + n % 3) % n] = static_cast<T>(7);
+                ok = ok && details::simd_mismatch(level, p, w.data(), size) ==
+                               std::mismatch(v.begin(), v.end(), w.begin()).first - v.begin();
+            }
+        }
+        return ok;
+    }
+
+    // every start offset and terminator position within a buffer, with and without a
+    // terminator before max
+    template <class T>
+    bool check_find_sentinel()
+    {
+        bool ok = true;
+        for (auto level : supported_simd_levels()) {
+            std::vector<T> v(400, static_cast<T>(1));
+            for (std::size_t start = 0; start < 40; ++start) {
+                for (std::size_t end = start; end < v.size(); end += (end - start < 140 ? 1 : 23)) {
+                    v[end] = T();
+                    const T* p = v.data() + start;
+                    const auto len = static_cast<std::ptrdiff_t>(end - start);
+                    ok = ok && details::simd_find_sentinel(level, p, PTRDIFF_MAX, T()) == len;
+                    ok = ok && details::simd_find_sentinel(level, p, len + 1, T()) == len;
+                    ok = ok && details::simd_find_sentinel(level, p, len, T()) == len;
+                    if (len > 0) ok = ok && details::simd_find_sentinel(level, p, len / 2, T()) == len / 2;
+                    ok = ok && details::simd_find_sentinel(level, p, 0, T()) == 0;
+                    v[end] = static_cast<T>(1);
+                }
+            }
+        }
+        return ok;
+    }
+}
+
+SUITE(search_tests)
+{
+    TEST(simd_kernels_match_std)
+    {
+        CHECK(check_search_algorithms<unsigned char>());
+        CHECK(check_search_algorithms<char>());
+        CHECK(check_search_algorithms<short>());
+        CHECK(check_search_algorithms<unsigned>());
+        CHECK(check_search_algorithms<long long>());
+        CHECK(check_search_algorithms<std::uint64_t>());
+        CHECK(check_search_algorithms<double>());
+    }
+
+    TEST(find_sentinel)
+    {
+        CHECK(check_find_sentinel<char>());
+        CHECK(check_find_sentinel<wchar_t>());
+        CHECK(check_find_sentinel<short>());
+        CHECK(check_find_sentinel<std::uint64_t>());
+
+        // any value can be the sentinel
+        const int ints[] = {3, 1, 4, 1, 5, 9, 2, 6, -1, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3, 8};
+        for (auto level : supported_simd_levels()) {
+            CHECK(details::simd_find_sentinel(level, ints, 20, -1) == 8);
+            CHECK(details::simd_find_sentinel(level, ints, 20, 9) == 5);
+            CHECK(details::simd_find_sentinel(level, ints, 20, 42) == 20);
+            CHECK(details::simd_find_sentinel(level, ints + 6, 14, 9) == 7);
+        }
+
+    }
+
+#ifdef GSL_TEST_HAS_MMAP
+    // a string that ends right before a page the process can not read
+    TEST(find_sentinel_stops_at_page_boundary)
+    {
+        const auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        void* mem = mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        CHECK(mem != MAP_FAILED);
+        if (mem == MAP_FAILED) return;
+        char* const first = static_cast<char*>(mem);
+        CHECK(mprotect(first + page, page, PROT_NONE) == 0);
+
+        std::memset(first, 'x', page);
+        for (auto level : supported_simd_levels()) {
+            for (std::size_t len = 0; len < 300; ++len) {
+                // the terminator is the last readable byte
+                const char* s = first + page - 1 - len;
+                first[page - 1] = '\0';
+                CHECK(details::simd_find_sentinel(level, s, PTRDIFF_MAX, '\0') ==
+                      static_cast<std::ptrdiff_t>(len));
+
+                // no terminator, but max stops the scan at the end of the page
+                first[page - 1] = 'x';
+                CHECK(details::simd_find_sentinel(level, s, static_cast<std::ptrdiff_t>(len + 1), '\0') ==
+                      static_cast<std::ptrdiff_t>(len + 1));
+            }
+        }
+        munmap(mem, 2 * page);
+    }
+#endif
+
+    TEST(find)
+    {
+        byte packet[] = {to_byte<1>(), to_byte<2>(), to_byte<0x7e>(), to_byte<4>()};
+        span<const byte> s = packet;
+        CHECK(find(s, to_byte<0x7e>()) == 2);
+        CHECK(find(s, to_byte<9>()) == s.size());
+        CHECK(find(span<const byte>(), to_byte<1>()) == 0);
+
+        int ints[] = {-1, 5, 70000};
+        CHECK(find(span<int>(ints), 5) == 1);
+        CHECK(find(span<int>(ints), 70000L) == 2);
+        CHECK(find(span<const int, 3>(ints), -1) == 0);
+
+        unsigned char uc[] = {255, 1};
+        CHECK(find(span<unsigned char>(uc), 255) == 0);
+        CHECK(find(span<unsigned char>(uc), 256u) == 2);
+    }
+
+    TEST(count)
+    {
+        std::vector<int> v(1000, 3);
+        v[10] = 4;
+        v[999] = 4;
+        CHECK(count(span<int>(v), 3) == 998);
+        CHECK(count(span<int>(v), 4) == 2);
+        CHECK(count(span<int>(v), 5LL) == 0);
+
+        std::string str = "a,b,,c";
+        CHECK(count(span<const char>(str.data(), 6), ',') == 3);
+    }
+
+    TEST(find_first_of)
+    {
+        std::string str = "key=value;other";
+        const char delims[] = {';', '='};
+        CHECK(find_first_of(span<const char>(str.data(), 15), span<const char>(delims)) == 3);
+        CHECK(find_first_of(span<const char>(str.data(), 3), span<const char>(delims)) == 3);
+        CHECK(find_first_of(span<const char>(str.data(), 15), span<const char>()) == 15);
+
+        // more delimiters than fit in vector registers
+        std::string many = "0123456789abcdefghij";
+        CHECK(find_first_of(span<const char>(str.data(), 15),
+                            span<const char>(many.data(), 20)) == 1);
+
+        std::vector<long> longs(100, 1);
+        longs[77] = 8;
+        std::vector<long> set(20, 9);
+        set[19] = 8;
+        CHECK(find_first_of(span<long>(longs), span<long>(set)) == 77);
+    }
+
+    TEST(search)
+    {
+        std::string str = "GET /index.html HTTP/1.1\r\nHost: example.com\r\n\r\n";
+        span<const char> s(str.data(), static_cast<std::ptrdiff_t>(str.size()));
+        const char crlfcrlf[] = {'\r', '\n', '\r', '\n'};
+        const char host[] = {'H', 'o', 's', 't'};
+        const char missing[] = {'x', 'y'};
+
+        CHECK(search(s, span<const char>(crlfcrlf)) == s.size() - 4);
+        CHECK(search(s, span<const char>(host)) == 26);
+        CHECK(search(s, span<const char>(missing)) == s.size());
+        CHECK(search(s, span<const char>()) == 0);
+        CHECK(search(s.first(2), span<const char>(host)) == 2);
+    }
+
+    TEST(mismatch)
+    {
+        int a[] = {1, 2, 3, 4};
+        int b[] = {1, 2, 5};
+        CHECK(mismatch(span<int>(a), span<int>(b)) == 2);
+        CHECK(mismatch(span<int>(a), span<int>(a)) == 4);
+        CHECK(mismatch(span<int>(a).first(2), span<int>(b)) == 2);
+        CHECK(mismatch(span<int>(), span<int>(b)) == 0);
+
+        std::vector<std::string> s1{"a", "b"};
+        std::vector<std::string> s2{"a", "c"};
+        CHECK(mismatch(span<std::string>(s1), span<std::string>(s2)) == 1);
+    }
+}
+
+SUITE(bitwise_tests)
+{
+    TEST(simd_kernels_match_scalar)
+    {
+        std::mt19937 rng(7);
+        for (auto level : supported_simd_levels()) {
+            for (std::size_t n = 0; n < 300; n += (n < 140 ? 1 : 41)) {
+                std::vector<byte> a(n), b(n);
+                for (auto& e : a) e = static_cast<byte>(rng());
+                for (auto& e : b) e = static_cast<byte>(rng());
+                const auto size = static_cast<std::ptrdiff_t>(n);
+
+                // one extra byte to catch writes past the end
+                std::vector<byte> out(n + 1, static_cast<byte>(0x5a));
+                bool ok = true;
+
+                details::bitwise_transform<details::bit_and_op>(level, a.data(), b.data(), out.data(), size);
+                for (std::size_t i = 0; i < n; ++i) ok = ok && out[i] == (a[i] & b[i]);
+                details::bitwise_transform<details::bit_or_op>(level, a.data(), b.data(), out.data(), size);
+                for (std::size_t i = 0; i < n; ++i) ok = ok && out[i] == (a[i] | b[i]);
+                details::bitwise_transform<details::bit_xor_op>(level, a.data(), b.data(), out.data(), size);
+                for (std::size_t i = 0; i < n; ++i) ok = ok && out[i] == (a[i] ^ b[i]);
+                details::bitwise_transform<details::bit_not_op>(level, a.data(), a.data(), out.data(), size);
+                for (std::size_t i = 0; i < n; ++i) ok = ok && out[i] == ~a[i];
+
+                CHECK(ok && out[n] == static_cast<byte>(0x5a));
+            }
+        }
+    }
+
+    TEST(binary_operations)
+    {
+        const byte a[] = {to_byte<0x0f>(), to_byte<0xf0>(), to_byte<0xff>()};
+        const byte b[] = {to_byte<0x3c>(), to_byte<0x3c>(), to_byte<0x00>()};
+        byte out[4] = {};
+
+        bitwise_and(a, b, out);
+        CHECK(out[0] == to_byte<0x0c>() && out[1] == to_byte<0x30>() && out[2] == to_byte<0x00>());
+        bitwise_or(a, b, out);
+        CHECK(out[0] == to_byte<0x3f>() && out[1] == to_byte<0xfc>() && out[2] == to_byte<0xff>());
+        bitwise_xor(a, b, out);
+        CHECK(out[0] == to_byte<0x33>() && out[1] == to_byte<0xcc>() && out[2] == to_byte<0xff>());
+        bitwise_not(a, out);
+        CHECK(out[0] == to_byte<0xf0>() && out[1] == to_byte<0x0f>() && out[2] == to_byte<0x00>());
+        CHECK(out[3] == to_byte<0>());
+
+        CHECK_THROW(bitwise_and(a, span<const byte>(b).first(2), out), fail_fast);
+        CHECK_THROW(bitwise_or(a, b, span<byte>(out).first(2)), fail_fast);
+        CHECK_THROW(bitwise_not(a, span<byte>(out).first(2)), fail_fast);
+    }
+
+    TEST(in_place_operations)
+    {
+        // a keystream the size of several vectors and a tail
+        std::vector<byte> data(1000), key(1000);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<byte>(i);
+            key[i] = static_cast<byte>(i * 7 + 3);
+        }
+        const auto original = data;
+
+        bitwise_xor(data, key);
+        CHECK(data != original);
+        bitwise_xor(data, key);
+        CHECK(data == original);
+
+        bitwise_not(data);
+        bitwise_not(data);
+        CHECK(data == original);
+
+        bitwise_or(data, key);
+        bitwise_and(data, key);
+        CHECK(data == key);
+
+        CHECK_THROW(bitwise_and(data, span<const byte>(key).first(999)), fail_fast);
+    }
+}
+
+SUITE(narrow_copy_tests)
+{
+    template <class To, class From>
+    void check_narrow_copy_against_narrow(const std::vector<From>& src)
+    {
+        std::vector<To> dest(src.size());
+        const auto result = narrow_copy(span<const From>(src), span<To>(dest));
+
+        std::ptrdiff_t expected = static_cast<std::ptrdiff_t>(src.size());
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            To t{};
+            if (!try_narrow(src[i], t)) {
+                expected = static_cast<std::ptrdiff_t>(i);
+                break;
+            }
+        }
+        CHECK_EQUAL(expected, result);
+
+        for (std::size_t i = 0; static_cast<std::ptrdiff_t>(i) < expected; ++i)
+            CHECK(dest[i] == narrow<To>(src[i]));
+    }
+
+    TEST(int64_to_int32)
+    {
+        std::vector<std::int64_t> v(1000);
+        std::iota(v.begin(), v.end(), -500);
+        check_narrow_copy_against_narrow<std::int32_t>(v);
+
+        // failures in the first block, a later block and the tail
+        v.resize(2500);
+        std::iota(v.begin(), v.end(), -1000);
+        for (std::size_t bad : {std::size_t(0), std::size_t(300), std::size_t(1500), std::size_t(2499)}) {
+            auto w = v;
+            w[bad] = std::int64_t(1) << 40;
+            check_narrow_copy_against_narrow<std::int32_t>(w);
+            w[bad] = -(std::int64_t(1) << 40);
+            check_narrow_copy_against_narrow<std::int32_t>(w);
+        }
+    }
+
+    TEST(first_offending_index)
+    {
+        std::vector<std::int64_t> v(1500, 1);
+        v[1100] = -(std::int64_t(1) << 33);
+        v[1101] = std::int64_t(1) << 33;
+        std::vector<std::int16_t> d(1500);
+        CHECK(narrow_copy(span<std::int64_t>(v), span<std::int16_t>(d)) == 1100);
+        CHECK(d[0] == 1);
+        CHECK(d[1099] == 1);
+    }
+
+    TEST(signedness_changes)
+    {
+        check_narrow_copy_against_narrow<std::uint8_t>(std::vector<int>{0, 1, 255});
+        check_narrow_copy_against_narrow<std::uint8_t>(std::vector<int>{0, 1, 256});
+        check_narrow_copy_against_narrow<std::uint32_t>(std::vector<std::int32_t>{5, -1, 7});
+        check_narrow_copy_against_narrow<std::int32_t>(
+            std::vector<std::uint32_t>{5, 0x7fffffffu, 0x80000000u});
+        check_narrow_copy_against_narrow<std::uint16_t>(
+            std::vector<std::uint64_t>{0xffffu, 0x10000u});
+        check_narrow_copy_against_narrow<std::int8_t>(std::vector<std::uint64_t>{127, 128});
+    }
+
+    TEST(widening_always_fits)
+    {
+        check_narrow_copy_against_narrow<std::int64_t>(
+            std::vector<std::int32_t>{std::numeric_limits<std::int32_t>::min(), 0,
+                                      std::numeric_limits<std::int32_t>::max()});
+        check_narrow_copy_against_narrow<std::uint64_t>(std::vector<std::uint8_t>{0, 255});
+    }
+
+    TEST(floating_point)
+    {
+        check_narrow_copy_against_narrow<float>(std::vector<double>{0.5, 1.0, -2.25});
+        check_narrow_copy_against_narrow<float>(std::vector<double>{0.5, 0.1});
+        check_narrow_copy_against_narrow<int>(std::vector<double>{1.0, 2.0, 2.5});
+    }
+
+    TEST(empty_and_short_destination)
+    {
+        std::vector<std::int32_t> d(2);
+        CHECK(narrow_copy(span<const std::int64_t>(), span<std::int32_t>(d)) == 0);
+
+        std::int64_t src[] = {1, 2, 3};
+        CHECK_THROW(narrow_copy(span<std::int64_t>(src), span<std::int32_t>(d)), fail_fast);
+    }
+}
+
+SUITE(gather_tests)
+{
+    template <class T>
+    T make_element(std::size_t i)
+    {
+        return static_cast<T>(i);
+    }
+
+    template <>
+    std::string make_element<std::string>(std::size_t i)
+    {
+        return std::to_string(i);
+    }
+
+    template <class T, class Index>
+    void check_gather(std::size_t table_size, std::size_t count)
+    {
+        std::vector<T> table;
+        for (std::size_t i = 0; i < table_size; ++i) table.push_back(make_element<T>(i + 1));
+
+        std::mt19937 rng(static_cast<std::mt19937::result_type>(table_size + count));
+        std::uniform_int_distribution<std::size_t> dist(0, table_size - 1);
+        std::vector<Index> indices(count);
+        for (auto& i : indices) i = static_cast<Index>(dist(rng));
+
+        std::vector<T> out(count);
+        gather(span<const T>(table), span<const Index>(indices), span<T>(out));
+        for (std::size_t i = 0; i < count; ++i)
+            CHECK(out[i] == table[static_cast<std::size_t>(indices[i])]);
+    }
+
+    TEST(gather_element_and_index_sizes)
+    {
+        for (std::size_t count : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 31u, 100u}) {
+            check_gather<std::int32_t, std::int32_t>(50, count);
+            check_gather<std::uint32_t, std::uint32_t>(50, count);
+            check_gather<float, std::int64_t>(50, count);
+            check_gather<std::int64_t, std::int32_t>(50, count);
+            check_gather<double, std::uint64_t>(50, count);
+            check_gather<std::int16_t, std::uint8_t>(50, count);
+            check_gather<std::string, std::ptrdiff_t>(50, count);
+        }
+    }
+
+    TEST(gather_validates_all_indices)
+    {
+        int table[] = {10, 20, 30};
+        int out[4] = {};
+        int good[] = {0, 2, 1, 2};
+        gather(span<int>(table), span<int>(good), span<int>(out));
+        CHECK((out[0] == 10 && out[1] == 30 && out[2] == 20 && out[3] == 30));
+
+        int too_large[] = {0, 1, 3, 0};
+        int negative[] = {0, -1, 0, 0};
+        CHECK_THROW(gather(span<int>(table), span<int>(too_large), span<int>(out)), fail_fast);
+        CHECK_THROW(gather(span<int>(table), span<int>(negative), span<int>(out)), fail_fast);
+        CHECK_THROW(gather(span<int>(table), span<int>(good), span<int>(out).first(3)), fail_fast);
+        CHECK_THROW(gather(span<int>(), span<int>(good), span<int>(out)), fail_fast);
+        gather(span<int>(), span<int>(), span<int>(out));
+
+        // a narrow index type whose whole range is valid
+        std::vector<int> large_table(300, 5);
+        std::int8_t narrow_indices[] = {0, 127};
+        std::int8_t negative_narrow_indices[] = {0, -128};
+        gather(span<int>(large_table), span<std::int8_t>(narrow_indices), span<int>(out));
+        CHECK_THROW(gather(span<int>(large_table), span<std::int8_t>(negative_narrow_indices),
+                           span<int>(out)),
+                    fail_fast);
+    }
+
+    TEST(scatter)
+    {
+        int table[5] = {};
+        const int values[] = {1, 2, 3, 4};
+        const unsigned indices[] = {4, 0, 2, 0};
+        scatter(span<const int>(values), span<const unsigned>(indices), span<int>(table));
+        CHECK((table[0] == 4 && table[1] == 0 && table[2] == 3 && table[3] == 0 && table[4] == 1));
+
+        const unsigned bad_indices[] = {4, 5, 0, 0};
+        CHECK_THROW(scatter(span<const int>(values), span<const unsigned>(bad_indices), span<int>(table)),
+                    fail_fast);
+        CHECK(table[4] == 1);
+    }
 }
 
 int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/aligned_span>
+
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+template <class T, std::size_t Alignment>
+using aligned_buffer = dyn_array<T, aligned_allocator<T, Alignment>>;
+
+SUITE(aligned_span_tests)
+{
+    TEST(default_constructor)
+    {
+        aligned_span<float, 32> s;
+        CHECK(s.size() == 0 && s.empty() && s.data() == nullptr);
+
+        aligned_span<float, 32, 0> fixed;
+        CHECK(fixed.size() == 0);
+    }
+
+    TEST(checked_construction)
+    {
+        alignas(32) float arr[16] = {};
+
+        aligned_span<float, 32> s(arr, 16);
+        CHECK(s.data() == arr && s.size() == 16 && s.size_bytes() == 64);
+
+        aligned_span<float, 32> t(arr, arr + 8);
+        CHECK(t.size() == 8);
+
+        CHECK_THROW((aligned_span<float, 32>(arr + 1, 4)), fail_fast);
+        CHECK_THROW((aligned_span<float, 32>(arr + 1, arr + 5)), fail_fast);
+
+        aligned_span<float, 16> u(arr + 4, 4);
+        CHECK(u.data() == arr + 4);
+
+        span<float> from = arr;
+        auto v = make_aligned_span<32>(from);
+        static_assert(std::is_same<decltype(v), aligned_span<float, 32>>::value, "make_aligned_span");
+        CHECK(v.size() == 16);
+        CHECK_THROW(make_aligned_span<32>(from.subspan(2)), fail_fast);
+
+        aligned_span<float, 32, 16> fixed(span<float, 16>{arr});
+        CHECK(fixed.size() == 16);
+    }
+
+    TEST(conversions)
+    {
+        alignas(64) int arr[8] = {};
+        aligned_span<int, 64> s(arr, 8);
+
+        // weaker alignment and const elements convert implicitly
+        aligned_span<int, 16> weaker = s;
+        aligned_span<const int, 64> const_view = s;
+        CHECK(weaker.data() == arr && const_view.size() == 8);
+
+        static_assert(!std::is_convertible<aligned_span<int, 16>, aligned_span<int, 64>>::value,
+                      "stronger alignment must be checked");
+        static_assert(!std::is_convertible<span<int>, aligned_span<int, 16>>::value,
+                      "spans convert explicitly, with a check");
+
+        span<int> plain = s.as_span();
+        CHECK(plain.data() == arr);
+        span<const int> container = const_view;
+        CHECK(container.size() == 8);
+    }
+
+    TEST(from_dyn_array)
+    {
+        aligned_buffer<float, 64> buffer(100);
+        aligned_span<float, 64> s = buffer;
+        aligned_span<float, 32> weaker = buffer;
+        CHECK(s.data() == buffer.data() && s.size() == 100 && weaker.size() == 100);
+
+        const aligned_buffer<float, 64>& cbuffer = buffer;
+        aligned_span<const float, 64> cs = cbuffer;
+        CHECK(cs.size() == 100);
+
+        dyn_array<float, huge_page_allocator<float>> huge(10);
+        aligned_span<float, 64> hs = huge;
+        CHECK(hs.size() == 10);
+
+        static_assert(!std::is_convertible<aligned_buffer<float, 16>&, aligned_span<float, 64>>::value,
+                      "insufficiently aligned buffers do not convert");
+        static_assert(!std::is_convertible<dyn_array<float>&, aligned_span<float, 32>>::value,
+                      "std::allocator makes no alignment guarantee");
+        static_assert(!std::is_convertible<const aligned_buffer<float, 64>&,
+                                           aligned_span<float, 64>>::value,
+                      "constness is kept");
+    }
+
+    TEST(element_access)
+    {
+        aligned_buffer<int, 32> buffer(8);
+        std::iota(buffer.begin(), buffer.end(), 0);
+        aligned_span<int, 32> s = buffer;
+
+        CHECK(s[3] == 3 && s.at(7) == 7 && s(0) == 0);
+        CHECK_THROW(s[8], fail_fast);
+        CHECK_THROW(s[-1], fail_fast);
+
+        CHECK(std::accumulate(s.begin(), s.end(), 0) == 28);
+        CHECK(*s.rbegin() == 7 && s.cend() - s.cbegin() == 8);
+    }
+
+    TEST(subviews_propagate_alignment)
+    {
+        aligned_buffer<float, 64> buffer(64);
+        aligned_span<float, 64> s = buffer;
+        aligned_span<float, 64, 32> fixed = s.first<32>();
+
+        auto f = s.first<8>();
+        static_assert(std::is_same<decltype(f), aligned_span<float, 64, 8>>::value, "first<>");
+        auto fr = s.first(8);
+        static_assert(std::is_same<decltype(fr), aligned_span<float, 64>>::value, "first()");
+
+        auto sub4 = s.subspan<4, 4>();
+        static_assert(std::is_same<decltype(sub4), aligned_span<float, 16, 4>>::value, "16 bytes in");
+        auto sub8 = s.subspan<8>();
+        static_assert(std::is_same<decltype(sub8), aligned_span<float, 32>>::value, "32 bytes in");
+        auto sub16 = s.subspan<16>();
+        static_assert(std::is_same<decltype(sub16), aligned_span<float, 64>>::value, "64 bytes in");
+        auto sub_rt = s.subspan(16, 8);
+        static_assert(std::is_same<decltype(sub_rt), aligned_span<float, 4>>::value, "run-time offset");
+        CHECK(sub4.data() == buffer.data() + 4 && sub8.size() == 56 && sub_rt.size() == 8);
+
+        // last<>() keeps alignment only when the extent is known
+        auto l_dyn = s.last<16>();
+        static_assert(std::is_same<decltype(l_dyn), aligned_span<float, 4, 16>>::value, "last<> dynamic");
+        auto l_fixed = fixed.last<16>();
+        static_assert(std::is_same<decltype(l_fixed), aligned_span<float, 64, 16>>::value, "last<> fixed");
+        auto l_rt = fixed.last(3);
+        static_assert(std::is_same<decltype(l_rt), aligned_span<float, 4>>::value, "last()");
+        CHECK(l_fixed.data() == buffer.data() + 16 && l_rt.size() == 3);
+
+        CHECK_THROW(s.subspan(65), fail_fast);
+        CHECK_THROW(s.first(65), fail_fast);
+        CHECK_THROW(s.last<65>(), fail_fast);
+    }
+
+    TEST(offset_alignment)
+    {
+        static_assert(details::offset_alignment(64, 0) == 64, "");
+        static_assert(details::offset_alignment(64, 4) == 4, "");
+        static_assert(details::offset_alignment(64, 24) == 8, "");
+        static_assert(details::offset_alignment(16, 96) == 16, "");
+
+        struct twelve
+        {
+            float f[3];
+        };
+        static_assert(details::element_offset_alignment<twelve, 64>::value == 4, "");
+        static_assert(details::element_offset_alignment<double, 64>::value == 8, "");
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -17,6 +17,9 @@
 #include <UnitTest++/UnitTest++.h> 
 #include <gsl/gsl>
 
+#include <cstring>
+#include <string>
+
 using namespace gsl;
 
 SUITE(assertion_tests)
@@ -45,6 +48,77 @@ SUITE(assertion_tests)
         CHECK(g(2) == 3);
         CHECK_THROW(g(9), fail_fast);
     }
+
+    int h(int i)
+    {
+        Expects_audit(i > 0 && i < 10);
+        return i;
+    }
+
+    TEST(expects_audit)
+    {
+        CHECK(h(2) == 2);
+#if defined(GSL_NO_AUDIT_CONTRACTS)
+        CHECK(h(10) == 10);
+#else
+        CHECK_THROW(h(10), fail_fast);
+#endif
+    }
+
+    int k(int i)
+    {
+        i++;
+        Ensures_audit(i > 0 && i < 10);
+        return i;
+    }
+
+    TEST(ensures_audit)
+    {
+        CHECK(k(2) == 3);
+#if defined(GSL_NO_AUDIT_CONTRACTS)
+        CHECK(k(9) == 10);
+#else
+        CHECK_THROW(k(9), fail_fast);
+#endif
+    }
+
+    std::string last_violation;
+
+    void record_violation(const char* message) { last_violation = message; }
+
+    struct custom_violation
+    {
+    };
+
+    void throw_custom_violation(const char*) { throw custom_violation{}; }
+
+    TEST(violation_handler)
+    {
+        CHECK(get_contract_violation_handler() == nullptr);
+        CHECK(set_contract_violation_handler(&record_violation) == nullptr);
+        CHECK(get_contract_violation_handler() == &record_violation);
+
+        CHECK(f(2) == 2);
+        CHECK(last_violation.empty());
+
+        CHECK_THROW(f(10), fail_fast);
+        CHECK(last_violation.find("GSL: Precondition failure at ") == 0);
+        CHECK(last_violation.find("assertion_tests.cpp") != std::string::npos);
+
+        try {
+            g(9);
+        }
+        catch (const fail_fast& e) {
+            CHECK(last_violation == e.what());
+            CHECK(std::strstr(e.what(), "GSL: Postcondition failure at ") == e.what());
+        }
+
+        CHECK(set_contract_violation_handler(&throw_custom_violation) == &record_violation);
+        CHECK_THROW(f(10), custom_violation);
+
+        set_contract_violation_handler(nullptr);
+        CHECK_THROW(f(10), fail_fast);
+    }
 }
 
 int main(int, const char *[])
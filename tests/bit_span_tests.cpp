@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/bit_span>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+// the reference: bits as bools, checked against a view of packed words
+template <class Word>
+std::vector<bool> unpack(const std::vector<Word>& words)
+{
+    const std::size_t bits = sizeof(Word) * 8;
+    std::vector<bool> v(words.size() * bits);
+    for (std::size_t i = 0; i < v.size(); ++i)
+        v[i] = (static_cast<std::uint64_t>(words[i / bits]) >> (i % bits)) & 1;
+    return v;
+}
+
+template <class Word>
+bool check_word_algorithms(unsigned seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<Word> words(40);
+    bool ok = true;
+    for (int round = 0; round < 200; ++round) {
+        // sparse, dense and empty bitmaps
+        const int density = round % 4;
+        for (auto& w : words) {
+            std::uint64_t r = rng();
+            if (density == 0) r = 0;
+            if (density == 1) r &= rng() & rng() & rng() & rng() & rng();
+            if (density == 1 && rng() % 4) r = 0;
+            w = static_cast<Word>(r);
+        }
+        const auto bits = unpack(words);
+        const auto total = static_cast<std::ptrdiff_t>(bits.size());
+        const auto offset = static_cast<std::ptrdiff_t>(rng() % bits.size());
+        const auto count = static_cast<std::ptrdiff_t>(rng() % static_cast<std::uint64_t>(total - offset + 1));
+
+        const bit_span<const Word> s(span<const Word>(words), offset, count);
+        const auto first = bits.begin() + offset;
+        const auto last = first + count;
+
+        ok = ok && s.size() == count;
+        ok = ok && s.count() == std::count(first, last, true);
+        ok = ok && s.find_first_set() == std::find(first, last, true) - first;
+        ok = ok && std::equal(s.begin(), s.end(), first);
+        for (std::ptrdiff_t i = 0; i < count; i += 1 + static_cast<std::ptrdiff_t>(rng() % 17))
+            ok = ok && s.find_next_set(i) == std::find(first + i + 1, last, true) - first;
+    }
+    return ok;
+}
+
+SUITE(bit_span_tests)
+{
+    TEST(construction_and_extent)
+    {
+        std::array<byte, 4> bytes = {};
+        bit_span<byte> a{span<byte>(bytes)};
+        CHECK(a.size() == 32 && a.offset() == 0 && a.words().size() == 4);
+
+        auto fixed = as_bits(span<byte, 4>(bytes));
+        static_assert(decltype(fixed)::extent == 32, "a fixed number of words has a fixed number of bits");
+        CHECK(fixed.size() == 32);
+
+        bit_span<const byte> c = a;
+        bit_span<const byte, 32> fixed_const = fixed;
+        CHECK(c.size() == 32 && fixed_const.size() == 32);
+        CHECK_THROW((bit_span<byte, 16>(a)), fail_fast);
+
+        std::vector<std::uint64_t> words(3);
+        bit_span<std::uint64_t> b(words);
+        CHECK(b.size() == 192);
+
+        bit_span<std::uint64_t> part(words, 70, 100);
+        CHECK(part.size() == 100 && part.offset() == 6 && part.words().data() == words.data() + 1);
+        CHECK(part.words().size() == 2);
+        CHECK_THROW((bit_span<std::uint64_t>(words, 100, 93)), fail_fast);
+        CHECK_THROW((bit_span<std::uint64_t>(words, -1, 1)), fail_fast);
+
+        bit_span<byte> empty;
+        CHECK(empty.empty() && empty.words().empty() && empty.begin() == empty.end());
+    }
+
+    TEST(bit_order_and_access)
+    {
+        std::array<std::uint8_t, 2> bytes = {0x01, 0x80};
+        bit_span<std::uint8_t> s{span<std::uint8_t>(bytes)};
+        CHECK(s[0] && !s[1] && s.test(15) && !s.test(8));
+
+        s[1] = true;
+        s.set(8);
+        s.reset(15);
+        s.flip(0);
+        CHECK(bytes[0] == 0x02 && bytes[1] == 0x01);
+
+        s[2] = s[1];
+        CHECK(bytes[0] == 0x06);
+        s[2].flip();
+        CHECK(bytes[0] == 0x02 && ~s[2]);
+
+        CHECK_THROW(s[16], fail_fast);
+        CHECK_THROW(s.set(-1), fail_fast);
+        CHECK_THROW(s.test(16), fail_fast);
+
+        // uint64 words are numbered from the least significant bit as well
+        std::uint64_t word = 0;
+        bit_span<std::uint64_t> w{span<std::uint64_t>(&word, 1)};
+        w.set(63);
+        w.set(32);
+        CHECK(word == 0x8000000100000000ull);
+    }
+
+    TEST(subviews)
+    {
+        std::vector<byte> bytes(8);
+        bit_span<byte> s(bytes);
+
+        auto middle = s.subspan(13, 30);
+        CHECK(middle.size() == 30 && middle.offset() == 5 && middle.words().data() == bytes.data() + 1);
+        middle.fill(true);
+        CHECK(s.count() == 30 && s.find_first_set() == 13 && !s.test(43) && s.test(42));
+        CHECK(middle.all() && !s.all());
+
+        auto inner = middle.subspan<3, 4>();
+        static_assert(decltype(inner)::extent == 4, "fixed subspan extent");
+        inner.fill(false);
+        CHECK(s.count() == 26 && !s.test(16) && s.test(15) && s.test(20));
+
+        CHECK(s.first(16).count() == 3 && s.last(20).count() == 0);
+        CHECK(s.first<16>().count() == 3 && s.last<22>().count() == 1);
+        CHECK_THROW(s.subspan(60, 5), fail_fast);
+        CHECK_THROW(s.first(65), fail_fast);
+        CHECK_THROW(middle.last<31>(), fail_fast);
+    }
+
+    TEST(find_and_count)
+    {
+        std::vector<std::uint64_t> words(100);
+        bit_span<std::uint64_t> s(words);
+        CHECK(s.none() && s.find_first_set() == s.size() && s.count() == 0);
+
+        s.set(3);
+        s.set(4000);
+        s.set(6399);
+        CHECK(s.any() && s.count() == 3);
+        CHECK(s.find_first_set() == 3);
+        CHECK(s.find_next_set(3) == 4000);
+        CHECK(s.find_next_set(4000) == 6399);
+        CHECK(s.find_next_set(6399) == s.size());
+        CHECK_THROW(s.find_next_set(6400), fail_fast);
+
+        std::vector<std::ptrdiff_t> found;
+        for (auto i = s.find_first_set(); i != s.size(); i = i + 1 < s.size() ? s.find_next_set(i) : s.size())
+            found.push_back(i);
+        CHECK((found == std::vector<std::ptrdiff_t>{3, 4000, 6399}));
+
+        // bits outside the view do not count
+        const auto view = s.subspan(4, 6394);
+        CHECK(view.count() == 1 && view.find_first_set() == 3996);
+    }
+
+    TEST(word_algorithms_match_reference)
+    {
+        CHECK(check_word_algorithms<std::uint8_t>(1));
+        CHECK(check_word_algorithms<std::uint16_t>(2));
+        CHECK(check_word_algorithms<std::uint32_t>(3));
+        CHECK(check_word_algorithms<std::uint64_t>(4));
+    }
+
+    TEST(iterators)
+    {
+        std::array<byte, 2> bytes = {};
+        bit_span<byte> s{span<byte>(bytes)};
+        for (auto it = s.begin() + 1; it < s.end(); it += 3) *it = true;
+        CHECK(s.count() == 5 && std::count(s.cbegin(), s.cend(), true) == 5);
+        CHECK(s.end() - s.begin() == 16);
+        CHECK(*s.rbegin() == false && *(s.rbegin() + 2) == true);
+
+        std::vector<bool> copy(s.begin(), s.end());
+        CHECK(copy.size() == 16 && copy[1] && copy[4] && !copy[2]);
+
+        int set = 0;
+        for (bool b : bit_span<const byte>(s)) set += b;
+        CHECK(set == 5);
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
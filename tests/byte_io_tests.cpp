@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/byte_io>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+enum class message_type : std::uint16_t
+{
+    ping = 1,
+    data = 0x0102
+};
+
+std::vector<byte> bytes(std::initializer_list<int> values)
+{
+    std::vector<byte> v;
+    for (int i : values) v.push_back(static_cast<byte>(i));
+    return v;
+}
+
+SUITE(byte_io_tests)
+{
+    TEST(read_little_and_big_endian)
+    {
+        const auto data = bytes({0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08});
+
+        byte_reader le(data);
+        CHECK(le.order() == endian::little && le.size() == 8);
+        CHECK(le.read<std::uint16_t>() == 0x0201);
+        CHECK(le.read<std::uint8_t>() == 0x03);
+        CHECK(le.read<std::int8_t>() == 0x04);
+        CHECK(le.read<std::uint32_t>() == 0x08070605u);
+        CHECK(le.empty() && le.position() == 8);
+
+        byte_reader be(data, endian::big);
+        CHECK(be.read<std::uint32_t>() == 0x01020304u);
+        CHECK(be.read<std::uint16_t>(endian::little) == 0x0605);
+        CHECK(be.read<std::uint16_t>() == 0x0708);
+
+        byte_reader wide(data, endian::big);
+        CHECK(wide.read<std::uint64_t>() == 0x0102030405060708ull);
+    }
+
+    TEST(signed_float_and_enum_values)
+    {
+        std::array<byte, 32> buffer;
+        byte_writer w(buffer, endian::big);
+        w.write<std::int32_t>(-2);
+        w.write(1.5);
+        w.write(-0.25f);
+        w.write(message_type::data);
+        CHECK(w.position() == 18);
+        CHECK(static_cast<int>(buffer[0]) == 0xff && static_cast<int>(buffer[3]) == 0xfe);
+        CHECK(static_cast<int>(buffer[16]) == 0x01 && static_cast<int>(buffer[17]) == 0x02);
+
+        byte_reader r(w.written_bytes(), endian::big);
+        CHECK(r.read<std::int32_t>() == -2);
+        CHECK(r.read<double>() == 1.5);
+        CHECK(r.read<float>() == -0.25f);
+        CHECK(r.read<message_type>() == message_type::data);
+        CHECK(r.empty());
+    }
+
+    TEST(unaligned_access)
+    {
+        std::array<byte, 16> buffer = {};
+        byte_writer w(buffer);
+        w.write<std::uint8_t>(0xaa);
+        w.write<std::uint64_t>(0x1122334455667788ull);
+        w.write<std::uint32_t>(0xdeadbeefu, endian::big);
+
+        byte_reader r(buffer);
+        r.skip(1);
+        CHECK(r.peek<std::uint64_t>() == 0x1122334455667788ull);
+        CHECK(r.read<std::uint64_t>() == 0x1122334455667788ull);
+        CHECK(r.read<std::uint32_t>(endian::big) == 0xdeadbeefu);
+    }
+
+    TEST(length_checks)
+    {
+        const auto data = bytes({1, 2, 3});
+        byte_reader r(data);
+        CHECK_THROW(r.read<std::uint32_t>(), fail_fast);
+        CHECK(r.position() == 0);
+        CHECK(r.read<std::uint16_t>() == 0x0201);
+        CHECK_THROW(r.read<std::uint16_t>(), fail_fast);
+        CHECK_THROW(r.peek<std::uint16_t>(), fail_fast);
+        CHECK_THROW(r.skip(2), fail_fast);
+        CHECK_THROW(r.read_bytes(-1), fail_fast);
+        CHECK(r.read<std::uint8_t>() == 3);
+
+        std::array<byte, 3> buffer;
+        byte_writer w(buffer);
+        CHECK_THROW(w.write<std::uint32_t>(1), fail_fast);
+        w.write<std::uint16_t>(1);
+        CHECK_THROW(w.write<std::uint16_t>(1), fail_fast);
+        const std::uint8_t two[] = {1, 2};
+        CHECK_THROW(w.write_array(span<const std::uint8_t>(two)), fail_fast);
+        CHECK_THROW(w.reserve_bytes(2), fail_fast);
+        CHECK(w.remaining() == 1 && !w.full());
+    }
+
+    TEST(arrays)
+    {
+        const std::uint32_t values[] = {1, 0x01020304u, 0xffffffffu};
+        std::array<byte, 16> buffer;
+
+        for (endian order : {endian::little, endian::big}) {
+            byte_writer w(buffer, order);
+            w.write_array(span<const std::uint32_t>(values));
+            CHECK(w.position() == 12);
+
+            std::uint32_t out[3] = {};
+            byte_reader r(buffer, order);
+            r.read_array(span<std::uint32_t>(out));
+            CHECK(out[0] == 1 && out[1] == 0x01020304u && out[2] == 0xffffffffu);
+            CHECK(r.remaining() == 4);
+        }
+
+        byte_writer w(buffer, endian::big);
+        w.write_array(span<const std::uint32_t>(values).first(2));
+        CHECK(static_cast<int>(buffer[3]) == 1 && static_cast<int>(buffer[4]) == 1 &&
+              static_cast<int>(buffer[7]) == 4);
+
+        std::uint32_t too_many[5];
+        byte_reader r(buffer);
+        CHECK_THROW(r.read_array(span<std::uint32_t>(too_many)), fail_fast);
+        CHECK(r.position() == 0);
+
+        std::uint16_t empty[1];
+        r.read_array(span<std::uint16_t>(empty).first(0));
+        CHECK(r.position() == 0);
+    }
+
+    TEST(byte_views)
+    {
+        const auto data = bytes({4, 'a', 'b', 'c', 'd', 9});
+        byte_reader r(data);
+        const auto length = r.read<std::uint8_t>();
+        const auto payload = r.read_bytes(length);
+        CHECK(payload.size() == 4 && payload.data() == data.data() + 1);
+        CHECK(r.consumed_bytes().size() == 5 && r.remaining_bytes().size() == 1);
+
+        std::array<byte, 8> buffer;
+        byte_writer w(buffer);
+        w.write_bytes(payload);
+        auto slot = w.reserve_bytes(2);
+        slot[0] = static_cast<byte>(1);
+        CHECK(w.written_bytes().size() == 6 && static_cast<char>(buffer[0]) == 'a' &&
+              static_cast<int>(buffer[4]) == 1);
+    }
+
+    TEST(batches)
+    {
+        std::array<byte, 16> buffer;
+        byte_writer w(buffer, endian::big);
+        {
+            auto header = w.batch(8);
+            header.write(message_type::ping);
+            header.write<std::uint16_t>(4);
+            header.write<std::uint32_t>(42);
+            CHECK(header.full());
+        }
+        CHECK(w.position() == 8);
+        CHECK_THROW(w.batch(9), fail_fast);
+
+        byte_reader r(buffer, endian::big);
+        auto header = r.batch(8);
+        CHECK(r.position() == 8 && header.size() == 8);
+        CHECK(header.read<message_type>() == message_type::ping);
+        CHECK(header.read<std::uint16_t>() == 4);
+        CHECK(header.read<std::uint32_t>() == 42);
+        CHECK_THROW(r.batch(9), fail_fast);
+
+        // reads inside a batch are still checked, with or without the audit checks
+        CHECK_THROW(header.read<std::uint8_t>(), fail_fast);
+
+        byte_reader packet(buffer);
+        auto words = packet.batch(8);
+        words.read<std::uint32_t>();
+        words.read<std::uint32_t>();
+        CHECK_THROW(words.read<std::uint32_t>(), fail_fast);
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/checksum>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+span<const byte> text(const char* s)
+{
+    return {reinterpret_cast<const byte*>(s), static_cast<std::ptrdiff_t>(std::strlen(s))};
+}
+
+SUITE(checksum_tests)
+{
+    TEST(known_values)
+    {
+        CHECK(crc32c(text("")) == 0);
+        CHECK(crc32c(text("a")) == 0xc1d04330u);
+        CHECK(crc32c(text("123456789")) == 0xe3069283u);
+
+        // RFC 3720, B.4
+        std::vector<byte> data(32, static_cast<byte>(0));
+        CHECK(crc32c(data) == 0x8a9136aau);
+        for (auto& b : data) b = static_cast<byte>(0xff);
+        CHECK(crc32c(data) == 0x62a8ab43u);
+        for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<byte>(i);
+        CHECK(crc32c(data) == 0x46dd794eu);
+        for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<byte>(31u - i);
+        CHECK(crc32c(data) == 0x113fdb5cu);
+    }
+
+    TEST(hardware_matches_slicing)
+    {
+        // every length and alignment around the block sizes of the interleaved loops
+        std::mt19937 rng(1);
+        std::vector<byte> data(3 * 8192 * 2 + 3 * 256 + 100);
+        for (auto& b : data) b = static_cast<byte>(rng());
+
+        std::vector<std::size_t> lengths;
+        for (std::size_t n = 0; n < 100; ++n) lengths.push_back(n);
+        for (std::size_t n : {767u, 768u, 769u, 3u * 8192 - 1, 3u * 8192, 3u * 8192 + 8 * 256 + 5,
+                              2u * 3 * 8192 + 3 * 256 + 7})
+            lengths.push_back(n);
+
+        for (details::simd_level level : {details::simd_level::scalar, details::cpu_simd_level()}) {
+            bool ok = true;
+            for (std::size_t offset = 0; offset < 9; ++offset)
+                for (std::size_t n : lengths) {
+                    const std::uint32_t start = static_cast<std::uint32_t>(rng());
+                    const auto p = reinterpret_cast<const unsigned char*>(data.data() + offset);
+                    ok = ok && details::crc32c_update(level, start, data.data() + offset, n) ==
+                                   details::crc32c_slicing(start, p, n);
+                }
+            CHECK(ok);
+        }
+    }
+
+    TEST(continuation_and_state)
+    {
+        std::vector<byte> data(100000);
+        std::mt19937 rng(2);
+        for (auto& b : data) b = static_cast<byte>(rng());
+        const span<const byte> all = data;
+        const std::uint32_t whole = crc32c(all);
+
+        CHECK(crc32c(all.subspan(777), crc32c(all.first(777))) == whole);
+
+        crc32c_state state;
+        CHECK(state.value() == 0);
+        std::ptrdiff_t pos = 0;
+        for (std::ptrdiff_t piece = 1; pos < all.size(); piece = piece * 3 + 1) {
+            const auto n = (std::min)(piece, all.size() - pos);
+            state.update(all.subspan(pos, n));
+            pos += n;
+        }
+        CHECK(state.value() == whole);
+
+        state.reset();
+        CHECK(state.update(text("1234")).update(text("56789")).value() == 0xe3069283u);
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////// 
+// 
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved. 
+// 
+// This code is licensed under the MIT License (MIT). 
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, 
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+// THE SOFTWARE. 
+// 
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef GSL_PROFILE_CONTRACTS
+#define GSL_PROFILE_CONTRACTS
+#endif
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/gsl>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+using namespace gsl;
+
+namespace
+{
+int checked(int i)
+{
+    Expects(i >= 0);
+    Ensures(i < 100);
+    return i;
+}
+
+GSL_CONTRACT_CONSTEXPR int constexpr_checked(int i)
+{
+    Expects(i > 0);
+    return i;
+}
+
+const contract_site_profile* find_site(const std::vector<contract_site_profile>& profile,
+                                       const char* condition)
+{
+    const auto it = std::find_if(profile.begin(), profile.end(), [&](const contract_site_profile& site) {
+        return std::strcmp(site.condition, condition) == 0;
+    });
+    return it == profile.end() ? nullptr : &*it;
+}
+}
+
+SUITE(contract_profile_tests)
+{
+    TEST(counts_every_execution)
+    {
+        reset_contract_profile();
+        for (int i = 0; i < 10; ++i) checked(i);
+
+        const auto profile = contract_profile();
+        const auto expects = find_site(profile, "i >= 0");
+        const auto ensures = find_site(profile, "i < 100");
+        CHECK(expects != nullptr);
+        CHECK(ensures != nullptr);
+        CHECK(expects->count == 10);
+        CHECK(ensures->count == 10);
+        CHECK(std::strcmp(expects->type, "Precondition") == 0);
+        CHECK(std::strcmp(ensures->type, "Postcondition") == 0);
+        CHECK(std::strstr(expects->file, "contract_profile_tests.cpp") != nullptr);
+        CHECK(expects->line + 1 == ensures->line);
+    }
+
+    TEST(counts_failed_checks)
+    {
+        reset_contract_profile();
+        CHECK_THROW(checked(-1), fail_fast);
+        CHECK(find_site(contract_profile(), "i >= 0")->count == 1);
+    }
+
+    TEST(counts_checks_in_library_types)
+    {
+        reset_contract_profile();
+        int arr[4] = {1, 2, 3, 4};
+        span<int> s = arr;
+        int sum = 0;
+        for (std::ptrdiff_t i = 0; i < s.size(); ++i) sum += s[i];
+        CHECK(sum == 10);
+
+        const auto profile = contract_profile();
+        const auto index_check = std::find_if(profile.begin(), profile.end(), [](const contract_site_profile& site) {
+            return std::strstr(site.file, "span") != nullptr && site.count == 4;
+        });
+        CHECK(index_check != profile.end());
+    }
+
+    TEST(profile_is_sorted_by_count)
+    {
+        reset_contract_profile();
+        checked(1);
+        CHECK(constexpr_checked(3) == 3);
+        CHECK(constexpr_checked(4) == 4);
+
+        const auto profile = contract_profile();
+        CHECK(profile.front().count == 2);
+        CHECK(std::strcmp(profile.front().condition, "i > 0") == 0);
+        CHECK((std::is_sorted(profile.begin(), profile.end(),
+                              [](const contract_site_profile& a, const contract_site_profile& b) {
+                                  return a.count > b.count;
+                              })));
+    }
+
+    TEST(reset_clears_counts)
+    {
+        checked(5);
+        reset_contract_profile();
+        for (const auto& site : contract_profile()) CHECK(site.count == 0);
+    }
+
+#if defined(GSL_HAS_IS_CONSTANT_EVALUATED) && !defined(GSL_NO_CXX14_CONSTEXPR)
+    TEST(constant_evaluation_is_not_counted)
+    {
+        constexpr int value = constexpr_checked(7);
+        CHECK(value == 7);
+    }
+#endif
+
+    TEST(write_report)
+    {
+        reset_contract_profile();
+        checked(1);
+        std::FILE* out = std::tmpfile();
+        write_contract_profile(out);
+        std::rewind(out);
+        char buffer[4096] = {};
+        const auto read = std::fread(buffer, 1, sizeof(buffer) - 1, out);
+        std::fclose(out);
+        CHECK(read > 0);
+        CHECK(std::strstr(buffer, "Precondition(i >= 0)") != nullptr);
+    }
+}
+
+int main(int, const char* [])
+{
+    set_contract_profile_exit_report(nullptr);
+    return UnitTest::RunAllTests();
+}
@@ -0,0 +1,162 @@
+/////////////////////////////////////////////////////////////////////////////// 
+// 
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved. 
+// 
+// This code is licensed under the MIT License (MIT). 
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, 
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN 
+// THE SOFTWARE. 
+// 
+///////////////////////////////////////////////////////////////////////////////
+
+// the tests are built in throw mode; this one exercises the sampled mode instead
+#undef GSL_THROW_ON_CONTRACT_VIOLATION
+#define GSL_SAMPLED_ON_CONTRACT_VIOLATION
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/gsl>
+
+#include <thread>
+
+using namespace gsl;
+
+namespace
+{
+struct violation
+{
+};
+
+// escapes the terminating failure path so that sampled violations can be counted
+void throw_violation(const char*) { throw violation{}; }
+
+int f(int i)
+{
+    Expects(i > 0 && i < 10);
+    return i;
+}
+
+// a second check site, with a countdown of its own
+int g(int i)
+{
+    Expects(i > 0);
+    return i;
+}
+
+int count_caught_violations(int calls)
+{
+    int caught = 0;
+    for (int i = 0; i < calls; ++i) {
+        try {
+            f(10);
+        }
+        catch (const violation&) {
+            ++caught;
+        }
+    }
+    return caught;
+}
+
+// runs out the current countdowns of both sites on the calling thread, so that their next
+// checks are sampled
+void restart_sampling(unsigned period)
+{
+    const auto previous = get_contract_sampling_period();
+    set_contract_sampling_period(1);
+    for (unsigned i = 0; i <= previous; ++i) {
+        f(1);
+        g(1);
+    }
+    set_contract_sampling_period(period);
+}
+}
+
+SUITE(contract_sampling_tests)
+{
+    TEST(default_period)
+    {
+        CHECK(get_contract_sampling_period() == GSL_CONTRACT_SAMPLING_PERIOD);
+    }
+
+    TEST(every_check_with_period_one)
+    {
+        restart_sampling(1);
+        CHECK(count_caught_violations(10) == 10);
+    }
+
+    TEST(every_nth_check)
+    {
+        restart_sampling(4);
+        CHECK(count_caught_violations(8) == 2);
+
+        restart_sampling(4);
+        CHECK_THROW(f(10), violation);
+        CHECK(f(10) == 10);
+        CHECK(f(10) == 10);
+        CHECK(f(10) == 10);
+        CHECK_THROW(f(10), violation);
+    }
+
+    TEST(period_zero_checks_everything)
+    {
+        restart_sampling(0);
+        CHECK(count_caught_violations(5) == 5);
+    }
+
+    TEST(valid_calls_are_unaffected)
+    {
+        restart_sampling(3);
+        for (int i = 1; i < 10; ++i) CHECK(f(i) == i);
+    }
+
+    TEST(countdown_is_per_thread)
+    {
+        restart_sampling(2);
+        CHECK_THROW(f(10), violation);
+
+        // a new thread starts with its own countdown, so its first check is sampled
+        int caught = 0;
+        std::thread t([&] { caught = count_caught_violations(4); });
+        t.join();
+        CHECK(caught == 2);
+
+        CHECK(f(10) == 10);
+        CHECK_THROW(f(10), violation);
+    }
+
+    TEST(countdown_is_per_site)
+    {
+        // an always true and an always false site running in step with the period: with a
+        // shared countdown, only the first of the two would ever be sampled
+        restart_sampling(2);
+        int caught = 0;
+        for (int i = 0; i < 100; ++i) {
+            CHECK(f(1) == 1);
+            try {
+                g(0);
+            }
+            catch (const violation&) {
+                ++caught;
+            }
+        }
+        CHECK(caught == 50);
+    }
+
+    TEST(span_indexing_is_sampled)
+    {
+        int arr[4] = {1, 2, 3, 4};
+        span<int> s = arr;
+        restart_sampling(1);
+        CHECK_THROW(s[4], violation);
+    }
+}
+
+int main(int, const char* [])
+{
+    set_contract_violation_handler(&throw_violation);
+    return UnitTest::RunAllTests();
+}
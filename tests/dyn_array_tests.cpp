@@ -0,0 +1,337 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/dyn_array>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+struct throws_on_copy
+{
+    static int live;
+    static int copies_left;
+
+    throws_on_copy() { ++live; }
+    throws_on_copy(const throws_on_copy&)
+    {
+        if (copies_left-- == 0) throw std::runtime_error("copy");
+        ++live;
+    }
+    ~throws_on_copy() { --live; }
+};
+
+int throws_on_copy::live = 0;
+int throws_on_copy::copies_left = 0;
+
+template <class Allocator>
+struct counting_allocator
+{
+    using value_type = typename Allocator::value_type;
+
+    counting_allocator(int* count) noexcept : count_(count) {}
+
+    value_type* allocate(std::size_t n)
+    {
+        ++*count_;
+        return Allocator().allocate(n);
+    }
+
+    void deallocate(value_type* p, std::size_t n) noexcept
+    {
+        --*count_;
+        Allocator().deallocate(p, n);
+    }
+
+    bool operator==(const counting_allocator& other) const { return count_ == other.count_; }
+    bool operator!=(const counting_allocator& other) const { return count_ != other.count_; }
+
+    int* count_;
+};
+
+template <class Allocator>
+struct propagating_allocator : counting_allocator<Allocator>
+{
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    propagating_allocator(int* count) noexcept : counting_allocator<Allocator>(count) {}
+};
+
+bool is_aligned(const void* p, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+SUITE(dyn_array_tests)
+{
+    TEST(default_constructor)
+    {
+        dyn_array<int> a;
+        CHECK(a.size() == 0 && a.empty() && a.data() == nullptr);
+        CHECK(a.begin() == a.end());
+
+        span<int> s = a;
+        CHECK(s.size() == 0);
+    }
+
+    TEST(size_constructor_value_initializes)
+    {
+        dyn_array<int> a(10);
+        CHECK(a.size() == 10 && !a.empty());
+        CHECK(a.size_bytes() == 10 * static_cast<std::ptrdiff_t>(sizeof(int)));
+        CHECK(std::all_of(a.begin(), a.end(), [](int i) { return i == 0; }));
+
+        dyn_array<std::string> b(3);
+        for (const auto& str : b) CHECK(str.empty());
+    }
+
+    TEST(fill_constructor)
+    {
+        dyn_array<std::string> a(4, "gsl");
+        CHECK(a.size() == 4);
+        for (const auto& str : a) CHECK(str == "gsl");
+    }
+
+    TEST(default_init_constructor)
+    {
+        dyn_array<int> a(100, default_init);
+        CHECK(a.size() == 100);
+        std::iota(a.begin(), a.end(), 0);
+        CHECK(a[99] == 99);
+
+        // non-trivial types are still default constructed
+        dyn_array<std::string> b(5, default_init);
+        for (const auto& str : b) CHECK(str.empty());
+    }
+
+    TEST(initializer_list_and_span_constructors)
+    {
+        dyn_array<int> a = {1, 2, 3};
+        CHECK(a.size() == 3 && a[0] == 1 && a[2] == 3);
+
+        std::vector<int> v = {4, 5, 6, 7};
+        dyn_array<int> b{span<int>(v)};
+        CHECK(b.size() == 4 && b[3] == 7);
+        CHECK(b.data() != v.data());
+
+        // converting element types
+        dyn_array<long> c{span<const int>(v)};
+        CHECK(c.size() == 4 && c[0] == 4L);
+    }
+
+    TEST(negative_size)
+    {
+        CHECK_THROW(dyn_array<int>(-1), fail_fast);
+    }
+
+    TEST(element_access)
+    {
+        dyn_array<int> a = {1, 2, 3};
+        a[1] = 20;
+        CHECK(a[1] == 20 && a.front() == 1 && a.back() == 3);
+        CHECK_THROW(a[3], fail_fast);
+        CHECK_THROW(a[-1], fail_fast);
+
+        const dyn_array<int>& ca = a;
+        CHECK(ca[1] == 20);
+        CHECK_THROW(ca[3], fail_fast);
+
+        dyn_array<int> empty;
+        CHECK_THROW(empty.front(), fail_fast);
+        CHECK_THROW(empty.back(), fail_fast);
+    }
+
+    TEST(iteration)
+    {
+        dyn_array<int> a = {1, 2, 3, 4};
+        CHECK(std::accumulate(a.cbegin(), a.cend(), 0) == 10);
+        CHECK(*a.rbegin() == 4 && *(a.crend() - 1) == 1);
+        CHECK(a.end() - a.begin() == a.size());
+    }
+
+    TEST(span_conversions)
+    {
+        dyn_array<int> a = {1, 2, 3, 4};
+
+        span<int> s = a;
+        CHECK(s.data() == a.data() && s.size() == a.size());
+        s[0] = 10;
+        CHECK(a[0] == 10);
+
+        const dyn_array<int>& ca = a;
+        span<const int> cs = ca;
+        CHECK(cs.data() == a.data() && cs.size() == 4);
+
+        CHECK(a.as_span().subspan(1, 2)[1] == 3);
+        CHECK(as_bytes(a.as_span()).size() == a.size_bytes());
+    }
+
+    TEST(copy_and_move)
+    {
+        dyn_array<std::string> a = {"a", "b", "c"};
+
+        dyn_array<std::string> b(a);
+        CHECK(b == a && b.data() != a.data());
+
+        dyn_array<std::string> c(std::move(b));
+        CHECK(c == a && b.empty() && b.data() == nullptr);
+
+        dyn_array<std::string> d = {"x"};
+        d = a;
+        CHECK(d == a);
+
+        d = dyn_array<std::string>{"y", "z"};
+        CHECK(d.size() == 2 && d[1] == "z");
+
+        swap(c, d);
+        CHECK(c.size() == 2 && d == a);
+    }
+
+    TEST(comparison)
+    {
+        dyn_array<int> a = {1, 2, 3};
+        dyn_array<int> b = {1, 2, 4};
+        CHECK(a != b && a < b && a <= b && b > a && b >= a);
+        CHECK(!(a == b) && !(a > b));
+    }
+
+    TEST(exception_safety)
+    {
+        throws_on_copy value;
+        throws_on_copy::copies_left = 3;
+        CHECK_THROW((dyn_array<throws_on_copy>(10, value)), std::runtime_error);
+        CHECK(throws_on_copy::live == 1);
+
+        throws_on_copy::copies_left = 10;
+        dyn_array<throws_on_copy> a(5, value);
+        CHECK(throws_on_copy::live == 6);
+
+        throws_on_copy::copies_left = 2;
+        CHECK_THROW((dyn_array<throws_on_copy>(a)), std::runtime_error);
+        CHECK(throws_on_copy::live == 6);
+    }
+
+    TEST(custom_allocator)
+    {
+        int count = 0;
+        using alloc = counting_allocator<std::allocator<int>>;
+        {
+            dyn_array<int, alloc> a(16, alloc(&count));
+            CHECK(count == 1);
+            dyn_array<int, alloc> b(a);
+            CHECK(count == 2 && b.get_allocator() == a.get_allocator());
+            dyn_array<int, alloc> c(std::move(a));
+            CHECK(count == 2);
+        }
+        CHECK(count == 0);
+    }
+
+    TEST(allocator_propagation)
+    {
+        int left = 0;
+        int right = 0;
+        {
+            using alloc = counting_allocator<std::allocator<std::string>>;
+            dyn_array<std::string, alloc> a({"a", "b", "c"}, alloc(&left));
+            dyn_array<std::string, alloc> b({"x"}, alloc(&right));
+
+            b = a;
+            CHECK(b == a && b.get_allocator() == alloc(&right));
+            CHECK(left == 1 && right == 1);
+
+            b = std::move(a);
+            CHECK(b.size() == 3 && b[2] == "c" && b.get_allocator() == alloc(&right));
+            CHECK(left == 1 && right == 1);
+
+            dyn_array<std::string, alloc> c({"y"}, alloc(&right));
+            const auto data = c.data();
+            b = std::move(c);
+            CHECK(b.data() == data && b[0] == "y" && c.empty());
+            CHECK(right == 1);
+
+            CHECK_THROW(swap(a, b), fail_fast);
+        }
+        CHECK(left == 0 && right == 0);
+        {
+            using alloc = propagating_allocator<std::allocator<int>>;
+            dyn_array<int, alloc> a(4, alloc(&left));
+            dyn_array<int, alloc> b(2, alloc(&right));
+
+            b = a;
+            CHECK(b == a && b.get_allocator() == alloc(&left));
+            CHECK(left == 2 && right == 0);
+
+            dyn_array<int, alloc> c(8, alloc(&right));
+            swap(a, c);
+            CHECK(a.size() == 8 && a.get_allocator() == alloc(&right));
+            CHECK(c.size() == 4 && c.get_allocator() == alloc(&left));
+
+            b = std::move(a);
+            CHECK(b.size() == 8 && b.get_allocator() == alloc(&right));
+            CHECK(left == 1 && right == 1);
+        }
+        CHECK(left == 0 && right == 0);
+
+        static_assert(std::is_nothrow_move_assignable<dyn_array<int>>::value,
+                      "stateless allocators always compare equal");
+        static_assert(!std::is_nothrow_move_assignable<
+                          dyn_array<int, counting_allocator<std::allocator<int>>>>::value,
+                      "unequal allocators copy on move assignment");
+    }
+
+    TEST(aligned_allocation)
+    {
+        dyn_array<char, aligned_allocator<char, 64>> a(3, default_init);
+        CHECK(is_aligned(a.data(), 64));
+
+        dyn_array<double, aligned_allocator<double, 4096>> b(1000);
+        CHECK(is_aligned(b.data(), 4096));
+        CHECK(b[999] == 0.0);
+
+        // the element alignment wins when it is stricter
+        CHECK((aligned_allocator<double, 1>::alignment == alignof(double)));
+    }
+
+    TEST(huge_page_allocation)
+    {
+        dyn_array<int, huge_page_allocator<int>> small(16);
+        CHECK(is_aligned(small.data(), 64));
+
+        const std::ptrdiff_t n = 3 * (1 << 20);
+        dyn_array<std::uint8_t, huge_page_allocator<std::uint8_t>> big(n, default_init);
+        CHECK(is_aligned(big.data(), huge_page_allocator<std::uint8_t>::huge_page_size));
+        std::fill(big.begin(), big.end(), std::uint8_t{7});
+        CHECK(big[n - 1] == 7);
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
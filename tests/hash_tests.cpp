@@ -0,0 +1,177 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/hash>
+
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+struct point
+{
+    int x, y;
+    bool operator==(const point& other) const { return x == other.x && y == other.y; }
+};
+
+} // namespace
+
+namespace std
+{
+template <>
+struct hash<point>
+{
+    size_t operator()(const point& p) const { return hash<int>{}(p.x) * 31 + hash<int>{}(p.y); }
+};
+} // namespace std
+
+namespace
+{
+
+SUITE(hash_tests)
+{
+    TEST(hash_bytes_is_stable)
+    {
+        const std::string text = "the quick brown fox jumps over the lazy dog";
+        const auto bytes = as_bytes(span<const char>(text.data(), static_cast<std::ptrdiff_t>(text.size())));
+
+        // the same input and seed always hash the same
+        const std::uint64_t h = hash_bytes(bytes);
+        CHECK(hash_bytes(bytes) == h && hash_bytes(bytes, 0) == h);
+        CHECK(hash_bytes(bytes, 1) != h);
+
+        // copies in other memory, at any alignment
+        std::vector<byte> buffer(text.size() + 8);
+        for (std::size_t offset = 0; offset < 8; ++offset) {
+            std::memcpy(buffer.data() + offset, text.data(), text.size());
+            CHECK(hash_bytes(span<const byte>(buffer).subspan(static_cast<std::ptrdiff_t>(offset),
+                                                              bytes.size())) == h);
+        }
+    }
+
+    TEST(hash_bytes_depends_on_every_byte)
+    {
+        // every length through the short, medium and 48 byte block paths, with every
+        // single bit flip, and the prefixes of each other
+        std::mt19937 rng(1);
+        std::vector<byte> data(130);
+        for (auto& b : data) b = static_cast<byte>(rng());
+
+        std::set<std::uint64_t> seen;
+        std::size_t hashes = 0;
+        for (std::ptrdiff_t n = 0; n <= 130; ++n) {
+            const auto s = span<byte>(data).first(n);
+            seen.insert(hash_bytes(s));
+            ++hashes;
+            for (std::ptrdiff_t i = 0; i < n; ++i)
+                for (int bit = 0; bit < 8; bit += 3) {
+                    s[i] ^= static_cast<byte>(1 << bit);
+                    seen.insert(hash_bytes(s));
+                    ++hashes;
+                    s[i] ^= static_cast<byte>(1 << bit);
+                }
+        }
+        CHECK(seen.size() == hashes);
+    }
+
+    TEST(hash_bytes_avalanche)
+    {
+        // flipping one input bit flips about half of the output bits
+        std::mt19937_64 rng(2);
+        double flipped = 0;
+        int trials = 0;
+        for (int round = 0; round < 200; ++round) {
+            std::uint64_t words[3] = {rng(), rng(), rng()};
+            const auto n = static_cast<std::ptrdiff_t>(1 + round % 24);
+            const auto s = as_writeable_bytes(span<std::uint64_t>(words)).first(n);
+            const std::uint64_t h = hash_bytes(s);
+            s[round % n] ^= static_cast<byte>(1 << (round % 8));
+            std::uint64_t d = h ^ hash_bytes(s);
+            for (; d; d &= d - 1) ++flipped;
+            ++trials;
+        }
+        const double average = flipped / trials;
+        CHECK(average > 28 && average < 36);
+    }
+
+    TEST(span_hash_matches_equality)
+    {
+        int a[] = {1, 2, 3, 4};
+        std::vector<int> b = {1, 2, 3, 4};
+        const std::hash<span<int>> h;
+        CHECK(h(span<int>(a)) == h(span<int>(b)));
+        CHECK(h(span<int>(a)) != h(span<int>(b).first(3)));
+        CHECK((std::hash<span<const int, 4>>{}(a) == h(span<int>(b))));
+
+        // elements compared with their own operator== are hashed with std::hash
+        point p[] = {{1, 2}, {3, 4}};
+        point q[] = {{1, 2}, {3, 4}};
+        CHECK(std::hash<span<point>>{}(p) == std::hash<span<point>>{}(q));
+        q[1].y = 5;
+        CHECK(std::hash<span<point>>{}(p) != std::hash<span<point>>{}(q));
+
+        std::unordered_set<span<const int>> set;
+        set.insert(span<const int>(a));
+        CHECK(set.count(span<const int>(b)) == 1);
+    }
+
+    TEST(string_span_keys)
+    {
+        const std::string keys[] = {"alpha", "beta", "gamma"};
+        std::unordered_map<cstring_span<>, int> map;
+        for (int i = 0; i < 3; ++i) map[keys[i]] = i;
+
+        // looked up through a view of other memory, without building a string
+        const char line[] = "key=beta;";
+        CHECK(map.at(cstring_span<>(line + 4, 4)) == 1);
+        CHECK(map.count(cstring_span<>(line, 3)) == 0);
+
+        const std::hash<cstring_span<>> h;
+        CHECK(h("beta") == h(cstring_span<>(line + 4, 4)));
+        CHECK((std::hash<string_span<>>{}(string_span<>(const_cast<char*>(keys[1].data()), 4)) == h("beta")));
+        CHECK((std::hash<cwstring_span<>>{}(L"beta") != std::hash<cwstring_span<>>{}(L"bet")));
+    }
+
+    TEST(zstring_span_keys)
+    {
+        char first[] = "config";
+        char second[] = "config";
+        const czstring_span<> a(first);
+        const czstring_span<> b(second);
+        CHECK(a == b && !(a != b));
+        CHECK(std::hash<czstring_span<>>{}(a) == std::hash<czstring_span<>>{}(b));
+        CHECK(std::hash<czstring_span<>>{}(a) == std::hash<cstring_span<>>{}("config"));
+
+        std::unordered_set<czstring_span<>> set;
+        set.insert(a);
+        CHECK(set.count(b) == 1);
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -1720,6 +1720,26 @@ SUITE(multi_span_tests)
                 CHECK(a[i] == 1);
             }
         }
+
+        {
+            multi_span<int, dynamic_range> av = a;
+            auto it = av.end();
+            CHECK_THROW(*it, fail_fast);
+            it = av.begin() + 3;
+            CHECK(*it == 1);
+            ++it;
+            CHECK_THROW(*it, fail_fast);
+        }
+
+#if !defined(GSL_NO_AUDIT_CONTRACTS)
+        {
+            // iterators of different spans do not compare
+            multi_span<int, dynamic_range> av = a;
+            multi_span<int, dynamic_range> other = a;
+            CHECK_THROW(av.begin() == other.begin(), fail_fast);
+            CHECK_THROW(av.end() - other.begin(), fail_fast);
+        }
+#endif
     }
 }
 
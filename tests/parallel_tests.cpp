@@ -0,0 +1,159 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/gsl_parallel>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+SUITE(parallel_tests)
+{
+    TEST(parallel_copy)
+    {
+        parallel_policy policy(4);
+        policy.min_bytes_per_thread = 64;
+        policy.streaming_threshold = 0;
+
+        std::vector<int> src(100003);
+        std::iota(src.begin(), src.end(), 0);
+
+        // streaming stores with an unaligned destination
+        {
+            std::vector<int> dst(src.size() + 1);
+            copy(policy, span<const int>(src), span<int>(dst).subspan(1));
+            CHECK(dst[0] == 0);
+            CHECK(std::equal(src.begin(), src.end(), dst.begin() + 1));
+        }
+
+        // without streaming stores, converting element type
+        {
+            policy.streaming_threshold = ~std::size_t(0);
+            std::vector<long> dst(src.size());
+            copy(policy, span<int>(src), span<long>(dst));
+            CHECK(std::equal(src.begin(), src.end(), dst.begin()));
+        }
+
+        // not trivially copyable
+        {
+            std::vector<std::string> strs(1000, "a fairly long string that is heap allocated");
+            std::vector<std::string> dst(strs.size());
+            copy(policy, span<std::string>(strs), span<std::string>(dst));
+            CHECK(dst == strs);
+        }
+
+        {
+            std::vector<int> dst(10);
+            CHECK_THROW(copy(policy, span<int>(src), span<int>(dst)), fail_fast);
+        }
+    }
+
+    TEST(parallel_copy_propagates_exceptions)
+    {
+        struct throws_on_copy
+        {
+            throws_on_copy() = default;
+            throws_on_copy& operator=(const throws_on_copy&) { throw std::runtime_error("copy"); }
+        };
+
+        parallel_policy policy(4);
+        policy.min_bytes_per_thread = 1;
+
+        std::vector<throws_on_copy> src(256);
+        std::vector<throws_on_copy> dst(256);
+        CHECK_THROW(copy(policy, span<throws_on_copy>(src), span<throws_on_copy>(dst)),
+                    std::runtime_error);
+    }
+
+    TEST(parallel_move)
+    {
+        {
+            parallel_policy policy(3);
+            policy.min_bytes_per_thread = 1;
+
+            std::vector<std::unique_ptr<int>> src;
+            for (int i = 0; i < 1000; ++i) src.emplace_back(new int(i));
+            std::vector<std::unique_ptr<int>> dst(1000);
+
+            move(policy, span<std::unique_ptr<int>>(src), span<std::unique_ptr<int>>(dst));
+            for (std::size_t i = 0; i < src.size(); ++i) {
+                CHECK(src[i] == nullptr);
+                CHECK(*dst[i] == static_cast<int>(i));
+            }
+        }
+
+        {
+            parallel_policy policy(2);
+            policy.min_bytes_per_thread = 1;
+            policy.streaming_threshold = 0;
+
+            std::vector<double> src(5000, 2.5);
+            std::vector<double> dst(5000);
+            move(policy, span<double>(src), span<double>(dst));
+            CHECK(dst == src);
+        }
+    }
+
+    TEST(parallel_fill)
+    {
+        parallel_policy policy(4);
+        policy.min_bytes_per_thread = 64;
+        policy.streaming_threshold = 0;
+
+        // streaming stores, unaligned start and odd length
+        {
+            std::vector<char> v(10007, 'x');
+            fill(policy, span<char>(v).subspan(3, 10000), 'y');
+            CHECK(v[0] == 'x' && v[1] == 'x' && v[2] == 'x');
+            CHECK(std::count(v.begin(), v.end(), 'y') == 10000);
+            CHECK(v[10003] == 'x');
+        }
+
+        {
+            std::vector<std::uint64_t> v(4099);
+            fill(policy, span<std::uint64_t>(v), 0x0123456789abcdefULL);
+            CHECK(std::count(v.begin(), v.end(), 0x0123456789abcdefULL) == 4099);
+        }
+
+        // element size that does not divide the store width
+        {
+            struct rgb
+            {
+                unsigned char r, g, b;
+            };
+            std::vector<rgb> v(3001);
+            fill(policy, span<rgb>(v), rgb{1, 2, 3});
+            CHECK(std::all_of(v.begin(), v.end(),
+                              [](const rgb& c) { return c.r == 1 && c.g == 2 && c.b == 3; }));
+        }
+
+        {
+            std::vector<std::string> v(500);
+            fill(policy, span<std::string>(v), std::string("abc"));
+            CHECK(std::count(v.begin(), v.end(), "abc") == 500);
+        }
+    }
+}
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/ring_buffer>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+SUITE(ring_buffer_tests)
+{
+    TEST(capacity)
+    {
+        spsc_ring_buffer<int> a(8);
+        CHECK(a.capacity() == 8 && a.empty() && a.size() == 0);
+
+        spsc_ring_buffer<int> b(5);
+        CHECK(b.capacity() == 8);
+
+        spsc_ring_buffer<int> c(1);
+        CHECK(c.capacity() == 1);
+
+        CHECK_THROW(spsc_ring_buffer<int>(0), fail_fast);
+        CHECK_THROW(spsc_ring_buffer<int>(-1), fail_fast);
+    }
+
+    TEST(prepare_commit_peek_consume)
+    {
+        spsc_ring_buffer<int> ring(8);
+
+        auto w = ring.prepare(5);
+        CHECK(w.size() == 5 && w.second.empty());
+        std::iota(w.first.begin(), w.first.end(), 0);
+        ring.commit(3);
+        CHECK(ring.size() == 3);
+
+        auto r = ring.peek();
+        CHECK(r.size() == 3 && r.first[0] == 0 && r.first[2] == 2);
+        ring.consume(2);
+        CHECK(ring.size() == 1);
+
+        r = ring.peek(10);
+        CHECK(r.size() == 1 && r.first[0] == 2);
+        ring.consume(1);
+        CHECK(ring.empty() && ring.peek().empty());
+    }
+
+    TEST(full_and_empty)
+    {
+        spsc_ring_buffer<int> ring(4);
+        auto w = ring.prepare();
+        CHECK(w.size() == 4);
+        ring.commit(4);
+        CHECK(ring.prepare().empty() && ring.prepare(1).size() == 0);
+
+        CHECK(ring.peek(2).size() == 2);
+        ring.consume(2);
+        CHECK(ring.prepare().size() == 2);
+    }
+
+    TEST(wraparound)
+    {
+        spsc_ring_buffer<int> ring(8);
+        ring.commit(ring.prepare(6).size());
+        ring.consume(ring.peek(6).size());
+
+        // the next window starts at slot 6 and wraps after two elements
+        auto w = ring.prepare(5);
+        CHECK(w.size() == 5 && w.first.size() == 2 && w.second.size() == 3);
+        CHECK(w.second.data() + 6 == w.first.data());
+        int v = 10;
+        for (auto& x : w.first) x = v++;
+        for (auto& x : w.second) x = v++;
+        ring.commit(5);
+
+        auto r = ring.peek();
+        CHECK(r.first.size() == 2 && r.second.size() == 3);
+        CHECK(r.first[0] == 10 && r.first[1] == 11 && r.second[0] == 12 && r.second[2] == 14);
+        ring.consume(5);
+        CHECK(ring.empty());
+    }
+
+    TEST(commit_and_consume_contracts)
+    {
+        spsc_ring_buffer<int> ring(4);
+        CHECK_THROW(ring.commit(5), fail_fast);
+        CHECK_THROW(ring.commit(-1), fail_fast);
+        CHECK_THROW(ring.prepare(-1), fail_fast);
+        CHECK_THROW(ring.consume(1), fail_fast);
+
+        ring.commit(ring.prepare(2).size());
+        CHECK_THROW(ring.commit(3), fail_fast);
+        ring.peek();
+        CHECK_THROW(ring.consume(3), fail_fast);
+        CHECK_THROW(ring.peek(-1), fail_fast);
+        ring.consume(2);
+    }
+
+    TEST(write_and_read)
+    {
+        spsc_ring_buffer<std::string> ring(4);
+        std::vector<std::string> in = {"a", "b", "c"};
+        CHECK(ring.write(in) == 3);
+        std::vector<std::string> more = {"d", "e"};
+        CHECK(ring.write(more) == 1);
+
+        std::vector<std::string> out(3);
+        CHECK(ring.read(out) == 3);
+        CHECK(out[0] == "a" && out[2] == "c");
+
+        // "e" now wraps around the end of the storage
+        CHECK(ring.write(span<const std::string>(more).subspan(1)) == 1);
+        out.assign(5, std::string());
+        CHECK(ring.read(out) == 2);
+        CHECK(out[0] == "d" && out[1] == "e");
+        CHECK(ring.read(out) == 0);
+    }
+
+    TEST(producer_consumer_stress)
+    {
+        // many small, irregular windows so that both sides wrap often and keep
+        // running into each other; run it under ThreadSanitizer to check the ordering
+        const std::uint32_t total = 1 << 18;
+        spsc_ring_buffer<std::uint32_t> ring(64);
+
+        std::thread producer([&] {
+            std::uint32_t next = 0;
+            std::uint32_t step = 1;
+            while (next < total) {
+                step = step * 5 % 37 + 1;
+                auto w = ring.prepare((std::min)(step, total - next));
+                if (w.empty()) std::this_thread::yield();
+                for (auto& x : w.first) x = next++;
+                for (auto& x : w.second) x = next++;
+                ring.commit(w.size());
+            }
+        });
+
+        std::uint32_t expected = 0;
+        std::uint32_t errors = 0;
+        std::uint32_t step = 1;
+        while (expected < total) {
+            step = step * 7 % 41 + 1;
+            auto r = ring.peek(step);
+            if (r.empty()) std::this_thread::yield();
+            for (auto x : r.first) errors += x != expected++;
+            for (auto x : r.second) errors += x != expected++;
+            ring.consume(r.size());
+        }
+        producer.join();
+
+        CHECK(errors == 0);
+        CHECK(ring.empty());
+    }
+
+    TEST(layout)
+    {
+        using ring = spsc_ring_buffer<int>;
+        static_assert(alignof(ring) >= cache_line_size, "the indices are on their own cache lines");
+        static_assert(sizeof(ring) == 3 * cache_line_size,
+                      "one line for the storage, one for each side's index and cached copy");
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
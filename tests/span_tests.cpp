@@ -38,6 +38,18 @@ struct BaseClass
 struct DerivedClass : BaseClass
 {
 };
+struct PointerIterated
+{
+    int value;
+};
+}
+
+namespace gsl
+{
+template <>
+struct use_pointer_iterators<PointerIterated> : std::true_type
+{
+};
 }
 
 SUITE(span_tests)
@@ -1128,6 +1140,40 @@ SUITE(span_tests)
         }
     }
 
+    TEST(iterator_steps_out_of_range)
+    {
+        int a[] = { 1, 2, 3, 4 };
+        span<int> s = a;
+
+#if !defined(GSL_NO_AUDIT_CONTRACTS)
+        // the audit checks catch the step itself
+        auto it = s.end();
+        CHECK_THROW(++it, fail_fast);
+        CHECK_THROW(it++, fail_fast);
+        CHECK(it == s.end());
+
+        it = s.begin();
+        CHECK_THROW(--it, fail_fast);
+        CHECK_THROW(it--, fail_fast);
+        CHECK(it == s.begin());
+        CHECK(*it == 1);
+#else
+        // without them, the iterator leaves the range but cannot be dereferenced there; the
+        // span sits inside a larger array, so its neighbours would be readable
+        span<int> inner = s.subspan(1, 2);
+        auto it = inner.end();
+        ++it;
+        CHECK_THROW(*it, fail_fast);
+        CHECK_THROW(it.operator->(), fail_fast);
+
+        it = inner.begin();
+        --it;
+        CHECK_THROW(*it, fail_fast);
+        ++it;
+        CHECK(*it == 2);
+#endif
+    }
+
     TEST(cbegin_cend)
     {
         {
@@ -1267,6 +1313,51 @@ SUITE(span_tests)
         }
     }
 
+    TEST(iterator_outlives_span)
+    {
+        int a[] = {1, 2, 3, 4};
+        span<int> s = a;
+
+        auto it = s.subspan(1).begin();
+        auto last = s.subspan(1).end();
+        CHECK(last - it == 3);
+        CHECK(*it == 2);
+        ++it;
+        CHECK(*it == 3);
+        it += 2;
+        CHECK(it == last);
+        CHECK_THROW(*it, fail_fast);
+
+        std::vector<int> v;
+        for (auto n : s.subspan(1, 2))
+            v.push_back(n);
+        CHECK((v == std::vector<int>{2, 3}));
+    }
+
+    TEST(pointer_iterators)
+    {
+        CHECK((std::is_same<span<PointerIterated>::iterator, PointerIterated*>::value));
+        CHECK((std::is_same<span<PointerIterated>::const_iterator, const PointerIterated*>::value));
+        CHECK((std::is_same<span<const PointerIterated>::iterator, const PointerIterated*>::value));
+        CHECK((std::is_same<span<PointerIterated, 2>::const_iterator, const PointerIterated*>::value));
+
+        PointerIterated a[] = {{1}, {2}, {3}};
+        span<PointerIterated> s = a;
+        CHECK(s.begin() == &a[0]);
+        CHECK(s.end() == &a[0] + 3);
+        CHECK(s.cbegin() == &a[0]);
+        CHECK(s.cend() - s.cbegin() == 3);
+        CHECK(s.rbegin()->value == 3);
+
+        int sum = 0;
+        for (auto& p : s)
+            sum += p.value;
+        CHECK(sum == 6);
+
+        span<PointerIterated> empty;
+        CHECK(empty.begin() == empty.end());
+    }
+
     TEST(comparison_operators)
     {
         {
@@ -1387,6 +1478,49 @@ SUITE(span_tests)
         }
     }
 
+    TEST(comparison_operators_trivial_types)
+    {
+        {
+            byte b1[] = {to_byte<1>(), to_byte<2>(), to_byte<0xff>()};
+            byte b2[] = {to_byte<1>(), to_byte<2>(), to_byte<0xff>()};
+            byte b3[] = {to_byte<1>(), to_byte<0x80>()};
+
+            span<const byte> s1 = b1;
+            span<const byte, 3> s2 = b2;
+            span<const byte> s3 = b3;
+
+            CHECK(s1 == s2);
+            CHECK(s2 == s1);
+            CHECK(!(s1 != s2));
+            CHECK(s1 != s3);
+            CHECK(s1 < s3);
+            CHECK(s2 < s3);
+            CHECK(!(s3 < s2));
+            CHECK(s3 >= s2);
+            CHECK(s1.first(2) < s1);
+            CHECK(s1.first(2) <= s2);
+        }
+
+        {
+            // memcmp order differs from element order for signed and multi-byte types
+            signed char c1[] = {-1};
+            signed char c2[] = {1};
+            CHECK(span<signed char>(c1) < span<signed char>(c2));
+
+            int i1[] = {256, 0};
+            int i2[] = {1, 0};
+            CHECK((span<int>(i2) < span<int, 2>(i1)));
+            CHECK(span<int>(i2) != span<int>(i1));
+        }
+
+        {
+            // object representation equality must not be used for floating point
+            double d1[] = {0.0};
+            double d2[] = {-0.0};
+            CHECK(span<double>(d1) == span<double>(d2));
+        }
+    }
+
     TEST(as_bytes)
     {
         int a[] = {1, 2, 3, 4};
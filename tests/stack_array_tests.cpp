@@ -0,0 +1,313 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/stack_array>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+struct counted
+{
+    static int live;
+
+    counted(int v = 0) : value(v) { ++live; }
+    counted(const counted& other) : value(other.value) { ++live; }
+    counted(counted&& other) noexcept : value(other.value)
+    {
+        other.value = -1;
+        ++live;
+    }
+    counted& operator=(const counted&) = default;
+    ~counted() { --live; }
+
+    int value;
+};
+
+int counted::live = 0;
+
+bool operator==(const counted& lhs, const counted& rhs) { return lhs.value == rhs.value; }
+
+template <class T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator(int* count) noexcept : count_(count) {}
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : count_(other.count_)
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++*count_;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        --*count_;
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const counting_allocator& other) const { return count_ == other.count_; }
+    bool operator!=(const counting_allocator& other) const { return count_ != other.count_; }
+
+    int* count_;
+};
+
+SUITE(stack_array_tests)
+{
+    TEST(stack_array_basics)
+    {
+        stack_array<int, 4> a = {{1, 2, 3, 4}};
+        CHECK(a.size() == 4 && !a.empty());
+        CHECK(a.size_bytes() == 4 * static_cast<std::ptrdiff_t>(sizeof(int)));
+        CHECK(a[0] == 1 && a[3] == 4 && a.front() == 1 && a.back() == 4);
+        CHECK_THROW(a[4], fail_fast);
+        CHECK_THROW(a[-1], fail_fast);
+
+        a.fill(7);
+        CHECK(std::all_of(a.begin(), a.end(), [](int i) { return i == 7; }));
+        CHECK(*a.rbegin() == 7 && a.cend() - a.cbegin() == 4);
+
+        static_assert(sizeof(stack_array<int, 4>) == 4 * sizeof(int), "stack_array holds only its elements");
+    }
+
+    TEST(stack_array_span_conversions)
+    {
+        stack_array<int, 3> a = {{1, 2, 3}};
+
+        span<int, 3> fixed = a.as_span();
+        CHECK(fixed.data() == a.data());
+        fixed[1] = 20;
+        CHECK(a[1] == 20);
+
+        span<int> s = a;
+        CHECK(s.size() == 3 && s.data() == a.data());
+
+        const stack_array<int, 3>& ca = a;
+        span<const int> cs = ca;
+        span<const int, 3> cfixed = ca.as_span();
+        CHECK(cs.size() == 3 && cfixed[2] == 3);
+    }
+
+    TEST(stack_array_comparison)
+    {
+        stack_array<int, 2> a = {{1, 2}};
+        stack_array<int, 2> b = {{1, 3}};
+        CHECK(a == a && a != b && a < b && a <= b && b > a && b >= a);
+    }
+
+#ifndef GSL_NO_CXX14_CONSTEXPR
+    TEST(stack_array_constexpr)
+    {
+        constexpr stack_array<int, 3> a = {{1, 2, 3}};
+        static_assert(a.size() == 3 && a[2] == 3 && a.back() == 3, "constexpr access");
+    }
+#endif
+
+    TEST(small_array_inline)
+    {
+        int allocations = 0;
+        using alloc = counting_allocator<int>;
+
+        small_array<int, 8, alloc> a(8, alloc(&allocations));
+        CHECK(a.is_inline() && allocations == 0);
+        CHECK(a.size() == 8 && std::all_of(a.begin(), a.end(), [](int i) { return i == 0; }));
+        CHECK(reinterpret_cast<const char*>(a.data()) >= reinterpret_cast<const char*>(&a) &&
+              reinterpret_cast<const char*>(a.data() + a.size()) <= reinterpret_cast<const char*>(&a + 1));
+
+        small_array<int, 8, alloc> b(9, alloc(&allocations));
+        CHECK(!b.is_inline() && allocations == 1);
+        b[8] = 5;
+        CHECK(b.back() == 5);
+        CHECK_THROW(b[9], fail_fast);
+    }
+
+    TEST(small_array_constructors)
+    {
+        small_array<std::string, 2> a = {"a", "b", "c"};
+        CHECK(a.size() == 3 && !a.is_inline() && a[2] == "c");
+
+        small_array<std::string, 4> b(3, "x");
+        CHECK(b.is_inline() && b[0] == "x" && b[2] == "x");
+
+        small_array<int, 16> c(10, default_init);
+        std::iota(c.begin(), c.end(), 0);
+        CHECK(c[9] == 9);
+
+        std::vector<int> v = {1, 2, 3};
+        small_array<long, 4> d{span<const int>(v)};
+        CHECK(d.size() == 3 && d[2] == 3L);
+
+        small_array<int, 4> empty;
+        CHECK(empty.empty() && empty.is_inline() && empty.begin() == empty.end());
+        CHECK_THROW(empty.front(), fail_fast);
+
+        CHECK_THROW((small_array<int, 4>(-1)), fail_fast);
+    }
+
+    TEST(small_array_span_conversions)
+    {
+        small_array<int, 4> a = {1, 2, 3};
+        span<int> s = a;
+        CHECK(s.data() == a.data() && s.size() == 3);
+
+        const small_array<int, 4>& ca = a;
+        span<const int> cs = ca;
+        CHECK(cs.size() == 3 && a.as_span().last(1)[0] == 3);
+    }
+
+    TEST(small_array_comparison)
+    {
+        small_array<int, 2> a = {1, 2};
+        small_array<int, 2> b = {1, 2, 3};
+        small_array<int, 2> c = {1, 3};
+        CHECK(a == a && a != b && a < b && a <= b && b > a && b >= a);
+        CHECK(b < c && c > b && !(c <= b) && !(b >= c));
+    }
+
+    TEST(small_array_copy_and_move)
+    {
+        {
+            small_array<counted, 2> inline_src = {counted(1), counted(2)};
+            small_array<counted, 2> heap_src = {counted(1), counted(2), counted(3)};
+            CHECK(counted::live == 5);
+
+            small_array<counted, 2> a(inline_src);
+            CHECK(a.is_inline() && a.size() == 2 && a[1].value == 2);
+
+            small_array<counted, 2> b(std::move(inline_src));
+            CHECK(b.is_inline() && b[1].value == 2 && inline_src.empty());
+
+            const counted* heap_data = heap_src.data();
+            small_array<counted, 2> c(std::move(heap_src));
+            CHECK(c.data() == heap_data && c.size() == 3 && heap_src.empty() && heap_src.is_inline());
+            CHECK(counted::live == 7);
+
+            a = c;
+            CHECK(!a.is_inline() && a.size() == 3 && a[2].value == 3);
+            c = std::move(b);
+            CHECK(c.is_inline() && c.size() == 2 && b.empty());
+            b = std::move(a);
+            CHECK(!b.is_inline() && b.size() == 3 && a.empty());
+            CHECK((b == small_array<counted, 2>(b) && b != c));
+            CHECK(counted::live == 5);
+        }
+        CHECK(counted::live == 0);
+    }
+
+    TEST(small_array_exception_safety)
+    {
+        struct throwing
+        {
+            throwing(int) {}
+            throwing(const throwing& other)
+            {
+                if (other.fail) throw std::runtime_error("copy");
+            }
+            bool fail = false;
+        };
+        std::vector<throwing> src(3, throwing(0));
+        src[2].fail = true;
+        CHECK_THROW((small_array<throwing, 4>{span<throwing>(src)}), std::runtime_error);
+        CHECK_THROW((small_array<throwing, 2>{span<throwing>(src)}), std::runtime_error);
+    }
+
+    TEST(arena_allocation)
+    {
+        stack_array<byte, 256> buffer;
+        arena scratch(buffer.as_span());
+        CHECK(scratch.capacity() == 256 && scratch.used() == 0);
+
+        void* p = scratch.allocate(3, 1);
+        void* q = scratch.allocate(8, 8);
+        CHECK(p == buffer.data());
+        CHECK(reinterpret_cast<std::uintptr_t>(q) % 8 == 0);
+        CHECK(scratch.used() >= 11 && scratch.remaining() == 256 - scratch.used());
+        CHECK_THROW(scratch.allocate(1000, 1), std::bad_alloc);
+        CHECK_THROW(scratch.allocate(1, 3), fail_fast);
+
+        scratch.reset();
+        CHECK(scratch.used() == 0 && scratch.allocate(1, 1) == buffer.data());
+    }
+
+    TEST(small_array_arena_fallback)
+    {
+        stack_array<byte, 1024> buffer;
+        arena scratch(buffer.as_span());
+        using alloc = arena_allocator<int>;
+
+        small_array<int, 4, alloc> small({1, 2, 3}, alloc(scratch));
+        CHECK(small.is_inline() && scratch.used() == 0);
+
+        small_array<int, 4, alloc> big(100, alloc(scratch));
+        CHECK(!big.is_inline() && scratch.used() >= 400);
+        CHECK(reinterpret_cast<const byte*>(big.data()) >= buffer.data() &&
+              reinterpret_cast<const byte*>(big.data() + 100) <= buffer.data() + 1024);
+        CHECK(big.get_allocator() == alloc(scratch));
+
+        CHECK_THROW((small_array<int, 4, alloc>(1000, alloc(scratch))), std::bad_alloc);
+    }
+
+    TEST(small_array_arena_assignment)
+    {
+        stack_array<byte, 1024> first_buffer;
+        stack_array<byte, 1024> second_buffer;
+        arena first(first_buffer.as_span());
+        arena second(second_buffer.as_span());
+        using alloc = arena_allocator<int>;
+
+        const auto in_second = [&second_buffer](const int* p, std::ptrdiff_t n) {
+            return reinterpret_cast<const byte*>(p) >= second_buffer.data() &&
+                   reinterpret_cast<const byte*>(p + n) <= second_buffer.data() + 1024;
+        };
+
+        small_array<int, 4, alloc> a(16, 7, alloc(first));
+        small_array<int, 4, alloc> b{alloc(second)};
+
+        b = a;
+        CHECK(b == a && b.get_allocator() == alloc(second) && in_second(b.data(), 16));
+
+        b = std::move(a);
+        CHECK(b.size() == 16 && b[15] == 7 && a.empty());
+        CHECK(b.get_allocator() == alloc(second) && in_second(b.data(), 16));
+
+        small_array<int, 4, alloc> c(32, 1, alloc(second));
+        const auto data = c.data();
+        b = std::move(c);
+        CHECK(b.data() == data && b.size() == 32 && c.empty());
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
@@ -423,6 +423,46 @@ SUITE(string_span_tests)
             CHECK(span >= string_span<>(vec));
         }
     }
+    TEST(ThreeWayCompare)
+    {
+        cstring_span<> span = "Hello";
+        CHECK(span.compare("Hello") == 0);
+        CHECK(span.compare("Help") < 0);
+        CHECK(span.compare("Hell") > 0);
+        CHECK(span.compare("Helloo") < 0);
+        CHECK(span.compare(std::string("A")) > 0);
+        CHECK(span.compare(cstring_span<>()) > 0);
+        CHECK(cstring_span<>().compare(cstring_span<>()) == 0);
+
+        // the same order as the operators, over strings long enough for the vector kernels
+        std::vector<std::string> strings;
+        for (int i = 0; i < 40; ++i) {
+            std::string s(static_cast<std::size_t>(30 + i % 7 * 11), 'x');
+            s[static_cast<std::size_t>(i * 13 % 30)] = static_cast<char>('a' + i % 5);
+            strings.push_back(s);
+        }
+        for (const auto& a : strings) {
+            for (const auto& b : strings) {
+                const cstring_span<> l = a, r = b;
+                const int cmp = l.compare(r);
+                CHECK((cmp < 0) == (a < b));
+                CHECK((cmp == 0) == (a == b));
+                CHECK((l < r) == (a < b));
+                CHECK((l == r) == (a == b));
+            }
+        }
+
+        // characters order as in std::string, char by unsigned value
+        const std::string high("a\xff"), low("ab");
+        CHECK(cstring_span<>(low) < cstring_span<>(high));
+        CHECK(cstring_span<>(high).compare(low) > 0);
+        CHECK((cstring_span<>(low) < cstring_span<>(high)) == (low < high));
+
+        const std::wstring wide_a(L"a\x100"), wide_b(L"a\xffff");
+        CHECK((cwstring_span<>(wide_a) < cwstring_span<>(wide_b)) == (wide_a < wide_b));
+        CHECK(cwstring_span<>(L"abc").compare(L"abd") < 0);
+    }
+
     TEST(ConstrutorsEnsureZ)
     {
         // remove z from literals
@@ -451,6 +491,26 @@ SUITE(string_span_tests)
 
             delete[] ptr;
         }
+
+        // long strings and the max bound
+        {
+            std::string str(1000, 'a');
+            CHECK(ensure_z(str.c_str()).size() == 1000);
+            CHECK(ensure_z(str.c_str(), 1000).size() == 1000);
+            CHECK_THROW(ensure_z(str.c_str(), 999), fail_fast);
+
+            std::wstring wstr(333, L'b');
+            CHECK(ensure_z(wstr.c_str()).size() == 333);
+            CHECK_THROW(ensure_z(wstr.c_str(), 100), fail_fast);
+        }
+
+        // other sentinels
+        {
+            int ints[] = {4, 8, 15, 16, 23, 42, -1};
+            CHECK((ensure_sentinel<int, -1>(ints).size() == 6));
+            CHECK((ensure_sentinel<int, 23>(ints).size() == 4));
+            CHECK_THROW((ensure_sentinel<int, 42>(ints, 3)), fail_fast);
+        }
     }
 
     TEST(Constructors)
@@ -878,6 +938,48 @@ SUITE(string_span_tests)
             CHECK(zspan.ensure_z().size() == 0);
         }
 
+        // the terminator found at construction is the one all views agree on
+        {
+            char buf[] = "key\0value";
+            zstring_span<> zspan({ buf, 10 });
+
+            CHECK(zspan.as_string_span().size() == 3);
+            CHECK(zspan.ensure_z().size() == 3);
+            CHECK(zspan.ensure_z() == cstring_span<>("key"));
+            CHECK(strlen(zspan.assume_z()) == 3);
+
+            // writes through the buffer need an explicit rescan, which all views then follow
+            buf[3] = '=';
+            CHECK(zspan.ensure_z().size() == 3);
+            CHECK(zspan.rescan_z().size() == 9);
+            CHECK(zspan.ensure_z() == cstring_span<>("key=value"));
+            CHECK(zspan.as_string_span().size() == 9);
+            CHECK(strlen(zspan.assume_z()) == 9);
+            CHECK(zspan == zstring_span<>({ buf, 10 }));
+
+            // a rescan that finds no terminator leaves the recorded one alone
+            czstring_span<> copy = czstring_span<>({ buf, 10 });
+            buf[9] = 'x';
+            CHECK_THROW(copy.rescan_z(), fail_fast);
+            CHECK(copy.as_string_span().size() == 9);
+            buf[9] = '\0';
+        }
+
+        // equality compares the strings before the terminators
+        {
+            char first[] = "key\0one";
+            char second[] = "key\0two";
+            char other[] = "kex";
+            const zstring_span<> a({ first, 8 });
+            const zstring_span<> b({ second, 8 });
+            const zstring_span<> c(other);
+
+            CHECK(a == b);
+            CHECK(!(a != b));
+            CHECK(a != c);
+            CHECK(!(a == c));
+        }
+
         // create zspan from non-zero terminated string
         {
             char buf[1];
@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/string_split>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+    template <class View>
+    vector<string> pieces(const View& view)
+    {
+        vector<string> ret;
+        for (cstring_span<> piece : view) ret.push_back(to_string(piece));
+        return ret;
+    }
+
+    // the pieces std::string::find gives, for comparison
+    vector<string> find_pieces(const string& s, const string& delim)
+    {
+        vector<string> ret;
+        string::size_type pos = 0;
+        for (;;) {
+            const auto next = s.find(delim, pos);
+            if (next == string::npos) break;
+            ret.push_back(s.substr(pos, next - pos));
+            pos = next + delim.size();
+        }
+        ret.push_back(s.substr(pos));
+        return ret;
+    }
+}
+
+SUITE(string_split_tests)
+{
+    TEST(split_char)
+    {
+        CHECK((pieces(split(cstring_span<>("a,b,c"), ',')) == vector<string>{"a", "b", "c"}));
+        CHECK((pieces(split(cstring_span<>(",a,,b,"), ',')) == vector<string>{"", "a", "", "b", ""}));
+        CHECK((pieces(split(cstring_span<>("abc"), ',')) == vector<string>{"abc"}));
+        CHECK((pieces(split(cstring_span<>(""), ',')) == vector<string>{""}));
+        CHECK((pieces(split(cstring_span<>(), ',')) == vector<string>{""}));
+        CHECK((pieces(split(cstring_span<>(","), ',')) == vector<string>{"", ""}));
+
+        // pieces are views into the original string
+        const string text = "key=value";
+        const cstring_span<> view = text;
+        auto it = split(view, '=').begin();
+        CHECK(it->data() == text.data());
+        ++it;
+        CHECK(it->data() == text.data() + 4);
+        CHECK(it->size() == 5);
+    }
+
+    TEST(split_string)
+    {
+        CHECK((pieces(split(cstring_span<>("a::b:c::"), "::")) == vector<string>{"a", "b:c", ""}));
+        CHECK((pieces(split(cstring_span<>("::::"), "::")) == vector<string>{"", "", ""}));
+        CHECK((pieces(split(cstring_span<>("a:"), "::")) == vector<string>{"a:"}));
+        CHECK_THROW(split(cstring_span<>("a"), cstring_span<>()), fail_fast);
+
+        // the view keeps only a view of the delimiter, which must outlive it
+        const string delim = "::";
+        CHECK((pieces(split(cstring_span<>("a::b"), delim)) == vector<string>{"a", "b"}));
+        CHECK((pieces(split_any(cstring_span<>("a:b"), delim)) == vector<string>{"a", "b"}));
+
+#ifdef CONFIRM_COMPILATION_ERRORS
+        split(cstring_span<>("a::b"), string("::"));
+        split_any(cstring_span<>("a:b"), string(":"));
+#endif
+    }
+
+    TEST(split_matches_find_loop)
+    {
+        // long enough for the vector kernels, with delimiters at every alignment
+        string text;
+        for (int i = 0; i < 500; ++i) text += string(static_cast<size_t>(i % 37), 'x') + (i % 5 ? "," : ",,");
+        const cstring_span<> view = text;
+        CHECK(pieces(split(view, ',')) == find_pieces(text, ","));
+        CHECK(pieces(split(view, ",,")) == find_pieces(text, ",,"));
+        CHECK(pieces(split(view, "x,")) == find_pieces(text, "x,"));
+    }
+
+    TEST(split_any)
+    {
+        CHECK((pieces(split_any(cstring_span<>("a b\tc  d"), " \t")) ==
+               vector<string>{"a", "b", "c", "", "d"}));
+        CHECK((pieces(split_any(cstring_span<>("abc"), " \t")) == vector<string>{"abc"}));
+        CHECK((pieces(split_any(cstring_span<>("abc"), cstring_span<>())) == vector<string>{"abc"}));
+    }
+
+    TEST(lines)
+    {
+        CHECK((pieces(lines(cstring_span<>("one\ntwo\r\nthree"))) == vector<string>{"one", "two", "three"}));
+        CHECK((pieces(lines(cstring_span<>("one\ntwo\n"))) == vector<string>{"one", "two"}));
+        CHECK((pieces(lines(cstring_span<>("\n\nx\n"))) == vector<string>{"", "", "x"}));
+        CHECK((pieces(lines(cstring_span<>("\r\n"))) == vector<string>{""}));
+        CHECK(pieces(lines(cstring_span<>(""))).empty());
+        CHECK(pieces(lines(cstring_span<>())).empty());
+    }
+
+    TEST(wide_and_mutable_strings)
+    {
+        wchar_t text[] = L"k1=v1;k2=v2";
+        vector<wstring> ret;
+        for (cwstring_span<> piece : split(wstring_span<>(text), L';')) ret.push_back(to_string(piece));
+        CHECK((ret == vector<wstring>{L"k1=v1", L"k2=v2"}));
+
+        char line[] = "a b";
+        CHECK(distance(split(string_span<>(line), ' ').begin(), split(string_span<>(line), ' ').end()) == 2);
+    }
+
+    TEST(iterators)
+    {
+        const auto view = split(cstring_span<>("a,b"), ',');
+        auto it = view.begin();
+        CHECK(it == view.begin());
+        CHECK(it != view.end());
+        auto old = it++;
+        CHECK(*old == "a");
+        CHECK(*it == "b");
+        CHECK(++it == view.end());
+        CHECK(decltype(view)::iterator() == view.end());
+        CHECK_THROW(++it, fail_fast);
+    }
+}
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }
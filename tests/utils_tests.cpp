@@ -111,6 +111,31 @@ SUITE(utils_tests)
         n = -42;
         CHECK_THROW(narrow<unsigned>(n), narrowing_error);
     }
+
+    TEST(try_narrow)
+    {
+        char c = 0;
+        CHECK(try_narrow(120, c));
+        CHECK(c == 120);
+        CHECK(!try_narrow(300, c));
+        CHECK(c == 120);
+
+        uint32_t u = 7;
+        CHECK(try_narrow(std::numeric_limits<int32_t>::max(), u));
+        CHECK(u == static_cast<uint32_t>(std::numeric_limits<int32_t>::max()));
+        CHECK(!try_narrow(int32_t(-1), u));
+        CHECK(!try_narrow(std::numeric_limits<int32_t>::min(), u));
+
+        int32_t i = 0;
+        CHECK(!try_narrow(std::numeric_limits<uint32_t>::max(), i));
+        CHECK(try_narrow(int64_t(-5), i));
+        CHECK(i == -5);
+
+        float f = 0;
+        CHECK(try_narrow(0.5, f));
+        CHECK(f == 0.5f);
+        CHECK(!try_narrow(0.1, f));
+    }
 }
 
 int main(int, const char *[])
@@ -0,0 +1,233 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2015 Microsoft Corporation. All rights reserved.
+//
+// This code is licensed under the MIT License (MIT).
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <UnitTest++/UnitTest++.h>
+#include <gsl/varint>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace std;
+using namespace gsl;
+
+namespace
+{
+
+std::vector<byte> bytes(std::initializer_list<int> values)
+{
+    std::vector<byte> v;
+    for (int i : values) v.push_back(static_cast<byte>(i));
+    return v;
+}
+
+// a mix of lengths that exercises every path of the bulk decoder
+template <class T>
+std::vector<T> mixed_values(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<T> v(n);
+    for (auto& x : v) {
+        const auto bits = static_cast<int>(rng() % 100 < 60 ? 7 : rng() % (sizeof(T) * 8 + 1));
+        const std::uint64_t r = rng();
+        x = static_cast<T>(bits == 64 ? r : r & ((1ull << bits) - 1));
+        if (std::is_signed<T>::value && rng() % 2) x = static_cast<T>(0 - x);
+    }
+    return v;
+}
+
+SUITE(varint_tests)
+{
+    TEST(single_values)
+    {
+        std::vector<byte> buffer(max_varint64_size);
+        CHECK(encode_varint(0, buffer) == 1 && static_cast<int>(buffer[0]) == 0);
+        CHECK(encode_varint(300, buffer) == 2);
+        CHECK(static_cast<int>(buffer[0]) == 0xac && static_cast<int>(buffer[1]) == 0x02);
+
+        std::uint32_t v32 = 0;
+        CHECK(decode_varint(buffer, v32) == 2 && v32 == 300);
+
+        CHECK(encode_varint(std::numeric_limits<std::uint64_t>::max(), buffer) == max_varint64_size);
+        std::uint64_t v64 = 0;
+        CHECK(decode_varint(buffer, v64) == max_varint64_size);
+        CHECK(v64 == std::numeric_limits<std::uint64_t>::max());
+        CHECK(decode_varint(buffer, v32) == 0);
+
+        CHECK(varint_size(0) == 1 && varint_size(127) == 1 && varint_size(128) == 2);
+        CHECK(varint_size(std::numeric_limits<std::uint32_t>::max()) == max_varint32_size);
+
+        CHECK_THROW(encode_varint(300, span<byte>(buffer).first(1)), fail_fast);
+    }
+
+    TEST(malformed_input)
+    {
+        std::uint32_t v32 = 7;
+        std::uint64_t v64 = 7;
+        CHECK(decode_varint(span<const byte>(), v32) == 0);
+
+        // truncated
+        const auto truncated = bytes({0x80, 0x80});
+        CHECK(decode_varint(truncated, v64) == 0 && v64 == 7);
+
+        // the largest 32 bit value, then one past it
+        const auto max32 = bytes({0xff, 0xff, 0xff, 0xff, 0x0f});
+        CHECK(decode_varint(max32, v32) == 5 && v32 == 0xffffffffu);
+        const auto over32 = bytes({0xff, 0xff, 0xff, 0xff, 0x1f});
+        CHECK(decode_varint(over32, v32) == 0);
+        CHECK(decode_varint(over32, v64) == 5 && v64 == 0x1ffffffffull);
+
+        // too long for either type
+        const auto over64 = bytes({0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x02});
+        CHECK(decode_varint(over64, v64) == 0);
+    }
+
+    TEST(zigzag)
+    {
+        CHECK(zigzag_encode(std::int32_t{0}) == 0u && zigzag_encode(std::int32_t{-1}) == 1u);
+        CHECK(zigzag_encode(std::int32_t{1}) == 2u && zigzag_encode(std::int32_t{-2}) == 3u);
+        CHECK(zigzag_encode(std::numeric_limits<std::int32_t>::min()) == 0xffffffffu);
+        CHECK(zigzag_encode(std::numeric_limits<std::int64_t>::max()) == 0xfffffffffffffffeull);
+        for (std::int64_t v : {std::int64_t{0}, std::int64_t{-5}, std::numeric_limits<std::int64_t>::min()})
+            CHECK(zigzag_decode(zigzag_encode(v)) == v);
+        CHECK(zigzag_decode(zigzag_encode(std::int32_t{-123456})) == -123456);
+    }
+
+    TEST(bulk_round_trip_32)
+    {
+        const auto values = mixed_values<std::uint32_t>(1000, 1);
+        std::vector<byte> buffer(values.size() * max_varint32_size);
+        const varint_result encoded = encode_varints(values, buffer);
+        CHECK(encoded.values == 1000);
+
+        std::vector<std::uint32_t> out(values.size());
+        const varint_result decoded = decode_varints(span<const byte>(buffer).first(encoded.bytes), out);
+        CHECK(decoded.values == 1000 && decoded.bytes == encoded.bytes);
+        CHECK(out == values);
+    }
+
+    TEST(bulk_round_trip_64)
+    {
+        const auto values = mixed_values<std::uint64_t>(1000, 2);
+        std::vector<byte> buffer(values.size() * max_varint64_size);
+        const varint_result encoded = encode_varints(values, buffer);
+        CHECK(encoded.values == 1000);
+
+        std::vector<std::uint64_t> out(values.size());
+        const varint_result decoded = decode_varints(span<const byte>(buffer).first(encoded.bytes), out);
+        CHECK(decoded.values == 1000 && decoded.bytes == encoded.bytes);
+        CHECK(out == values);
+    }
+
+    TEST(bulk_round_trip_zigzag)
+    {
+        const auto values32 = mixed_values<std::int32_t>(500, 3);
+        const auto values64 = mixed_values<std::int64_t>(500, 4);
+        std::vector<byte> buffer(500 * max_varint64_size);
+
+        const varint_result e32 = encode_zigzag_varints(values32, buffer);
+        std::vector<std::int32_t> out32(500);
+        CHECK(decode_zigzag_varints(span<const byte>(buffer).first(e32.bytes), out32).values == 500);
+        CHECK(out32 == values32);
+
+        const varint_result e64 = encode_zigzag_varints(values64, buffer);
+        std::vector<std::int64_t> out64(500);
+        CHECK(decode_zigzag_varints(span<const byte>(buffer).first(e64.bytes), out64).values == 500);
+        CHECK(out64 == values64);
+    }
+
+    TEST(bulk_single_byte_run)
+    {
+        std::vector<std::uint32_t> values(100);
+        for (std::size_t i = 0; i < values.size(); ++i) values[i] = static_cast<std::uint32_t>(i);
+        std::vector<byte> buffer(100);
+        CHECK(encode_varints(values, buffer).bytes == 100);
+
+        std::vector<std::uint64_t> out(100);
+        CHECK(decode_varints(buffer, out).values == 100);
+        for (std::size_t i = 0; i < out.size(); ++i) CHECK(out[i] == i);
+    }
+
+    TEST(bulk_stops_early)
+    {
+        const auto values = mixed_values<std::uint32_t>(200, 5);
+        std::vector<byte> buffer(200 * max_varint32_size);
+        const varint_result encoded = encode_varints(values, buffer);
+
+        // output full
+        std::vector<std::uint32_t> out(50);
+        const varint_result part = decode_varints(buffer, out);
+        CHECK(part.values == 50);
+        CHECK(std::vector<std::uint32_t>(values.begin(), values.begin() + 50) == out);
+        std::uint32_t next = 0;
+        CHECK(decode_varint(span<const byte>(buffer).subspan(part.bytes), next) > 0 && next == values[50]);
+
+        // input ends inside a value
+        std::vector<std::uint32_t> all(200);
+        const varint_result cut = decode_varints(span<const byte>(buffer).first(encoded.bytes - 1), all);
+        CHECK(cut.values == 199);
+
+        // a malformed value in the middle
+        std::vector<byte> bad(buffer.begin(), buffer.begin() + encoded.bytes);
+        const auto at = static_cast<std::size_t>(part.bytes);
+        bad.insert(bad.begin() + static_cast<std::ptrdiff_t>(at), 6, static_cast<byte>(0xff));
+        const varint_result stopped = decode_varints(bad, all);
+        CHECK(stopped.values == 50 && stopped.bytes == part.bytes);
+
+        // output room runs out while encoding
+        std::vector<byte> small(20);
+        const varint_result encoded_part = encode_varints(values, small);
+        CHECK(encoded_part.bytes <= 20 && encoded_part.values < 200);
+        std::vector<std::uint32_t> check(static_cast<std::size_t>(encoded_part.values));
+        CHECK(decode_varints(span<const byte>(small).first(encoded_part.bytes), check).bytes ==
+              encoded_part.bytes);
+    }
+
+    TEST(matches_scalar_decoder)
+    {
+        // random encodings of every length hit every shuffle table entry
+        std::mt19937 rng(6);
+        std::vector<byte> data;
+        while (data.size() < 4096) {
+            const auto length = rng() % 2 == 0 ? 1u : rng() % 5 + 1;
+            for (unsigned i = 1; i < length; ++i) data.push_back(static_cast<byte>(rng() | 0x80));
+            data.push_back(static_cast<byte>(rng() % (length == 5 ? 0x10 : 0x80)));
+        }
+        // followed by a value too large for 32 bits
+        const std::size_t valid = data.size();
+        for (int b : {0xff, 0xff, 0xff, 0xff, 0x7f}) data.push_back(static_cast<byte>(b));
+        data.resize(data.size() + 32, static_cast<byte>(1));
+
+        std::vector<std::uint32_t> simd(data.size());
+        std::vector<std::uint32_t> scalar(data.size());
+        for (std::size_t size : {data.size(), valid, valid - 1, std::size_t{100}, std::size_t{17}}) {
+            const varint_result a = decode_varints(span<const byte>(data).first(static_cast<std::ptrdiff_t>(size)), simd);
+            const varint_result b = details::decode_varints_scalar<false>(
+                data.data(), static_cast<std::ptrdiff_t>(size), scalar.data(), static_cast<std::ptrdiff_t>(scalar.size()));
+            CHECK(a.bytes == b.bytes && a.values == b.values);
+            const auto complete = static_cast<std::ptrdiff_t>(std::min(size, valid));
+            CHECK(a.bytes <= complete && a.bytes > complete - max_varint32_size);
+            CHECK(std::equal(simd.begin(), simd.begin() + a.values, scalar.begin()));
+        }
+    }
+}
+
+} // namespace
+
+int main(int, const char* []) { return UnitTest::RunAllTests(); }